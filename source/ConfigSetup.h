@@ -15,6 +15,8 @@ EMP_BUILD_CONFIG(SymConfigBase,
     VALUE(POP_SIZE, int, -1, "Starting size of the host population, -1 for full starting population"),
     VALUE(SYM_LIMIT, int, 1, "Number of symbiont allowed to infect a single host"),
     VALUE(START_MOI, double, 1, "Ratio of symbionts to hosts that experiment should start with"),
+    VALUE(POP_FILE, std::string, "", "File to take the starting population from instead of POP_SIZE, HOST_INT, SYM_INT and START_MOI: a checkpoint from a run of the same mode and world size, or a CSV of cell,host_int_val,sym_int_vals rows (symbiont values separated by spaces, no host value for a cell without a host). Empty for none"),
+    VALUE(BULK_SETUP, bool, 0, "Build the starting population in bulk and in parallel, which is much faster for large worlds: hosts go to distinct cells and symbionts to distinct hosts (or cells with FREE_LIVING_SYMS), so none are lost. The population differs from the default setup's, but not with the number of threads (0 for no, 1 for yes)"),
     VALUE(UPDATES, int, 1001, "Number of updates to run before quitting"),
     VALUE(RES_DISTRIBUTE, int, 100, "Number of resources to give to each host each update if they are available"),
     VALUE(LIMITED_RES_TOTAL, int, -1, "Starting number of total resources available over the entire run, -1 for unlimited"),
@@ -33,6 +35,34 @@ EMP_BUILD_CONFIG(SymConfigBase,
     VALUE(NO_MUT_UPDATES, int, 0, "How many updates should be run after the end of UPDATES with all mutation turned off?"),
     VALUE(FILE_PATH, std::string, "", "Output file path"),
     VALUE(FILE_NAME, std::string, "_data", "Root output file name"),
+    VALUE(REPLICATES, int, 1, "Number of replicates (seeds SEED, SEED+1, ...) to run side by side; with more than 1, each data file is also aggregated across replicates into a _SEEDS<first>-<last> file of per-column means, variances and 95% CI half-widths"),
+    VALUE(REPLICATE_FILES, bool, 1, "When running several replicates, also write each replicate's own data files? (0 for no, 1 for yes)"),
+    VALUE(ROLLUP_LEVELS, std::string, "", "Spans of updates (e.g. 10,100,1000, each a multiple of the one before) to roll data file rows up over, each into its own _rollup<span> file of per-column means, minimums and maximums; the data files themselves then only keep their last ROLLUP_RECENT rows. Empty for none"),
+    VALUE(ROLLUP_RECENT, int, 1000, "Number of most recent full-resolution rows each data file keeps when ROLLUP_LEVELS is set"),
+    VALUE(CHECKPOINT_INT, int, 0, "How often (in updates) to save a checkpoint of the whole run, which is resumed from if it exists when the run starts (only by a run of the same build on the same platform), 0 for never"),
+    VALUE(CHECKPOINT_FILE, std::string, "", "Checkpoint file to save to and resume from, empty for Checkpoint<FILE_NAME>_SEED<seed>.bin in FILE_PATH"),
+    VALUE(TREATMENTS, std::string, "", "Treatments to branch into after a shared burn-in, separated by semicolons, each a list of NAME=VALUE setting overrides separated by commas (e.g. VERTICAL_TRANSMISSION=0.2;VERTICAL_TRANSMISSION=0.8,SYNERGY=3). Each treatment runs in its own forked process with _T<index> added to FILE_NAME. Empty for none"),
+    VALUE(BURN_IN_UPDATES, int, 0, "Number of updates to run with the base settings, once, before branching into TREATMENTS"),
+    VALUE(DIGEST_INT, int, 0, "How often (in updates) to add the world's state to a rolling digest written to Digest<FILE_NAME>_SEED<seed>.data, for comparing runs with symbulation-digest-compare, 0 for never"),
+    VALUE(EVENT_LOG, bool, 0, "Should births, deaths, infections, lysis bursts and free-living symbiont moves be logged to EventLog<FILE_NAME>_SEED<seed>.bin, which symbulation-replay turns into data files without rerunning? 0 for no, 1 for yes"),
+    VALUE(ISLANDS, int, 1, "Number of islands (separate worlds of GRID_X by GRID_Y, each run on its own thread, with seeds SEED, SEED+1, ... and _I<index> added to FILE_NAME) to run as one metapopulation, 1 for a single world"),
+    VALUE(MIGRATION_INT, int, 100, "How often (in updates) hosts and free-living symbionts migrate between islands"),
+    VALUE(MIGRATION_RATE, double, 0.001, "Chance each host (with its symbionts) and free-living symbiont has of moving to a random other island at each migration"),
+    VALUE(TAU_LEAP, bool, 0, "Run the default mode with the approximate tau-leaping engine, which advances whole bins of hosts and symbionts at once, for very large well-mixed (GRID 0) worlds without free-living symbionts? Only HostVals and SymVals files are written (0 for no, 1 for yes)"),
+    VALUE(TAU_LEAP_BINS, int, 201, "Number of interaction value bins (evenly spaced from -1 to 1) the tau-leaping engine counts organisms in"),
+    VALUE(MEAN_FIELD, bool, 0, "Run the default mode with the deterministic mean-field solver, which evolves the expected numbers of hosts and symbionts in each interaction value bin, for fast scans over TREATMENTS (run one after another, without a burn-in) in well-mixed (GRID 0) worlds without free-living symbionts? Only HostVals and SymVals files are written (0 for no, 1 for yes)"),
+    VALUE(MEAN_FIELD_BINS, int, 41, "Number of interaction value bins (evenly spaced from -1 to 1) the mean-field solver uses"),
+    VALUE(STOP_HOST_EXTINCTION, bool, 0, "Stop the run early, writing a final data row, if the hosts go extinct (0 for no, 1 for yes)"),
+    VALUE(STOP_SYM_EXTINCTION, bool, 0, "Stop the run early, writing a final data row, if the symbionts (hosted and free-living) go extinct (0 for no, 1 for yes)"),
+    VALUE(STOP_INTVAL_VARIANCE, double, -1, "Stop the run early, writing a final data row, once the variance of both host and symbiont interaction values is at most this, -1 for never"),
+    VALUE(STOP_CHECK_START, int, 0, "First update at which the extinction and variance stop conditions are checked"),
+    VALUE(STOP_WALL_SECONDS, double, -1, "Stop the run early, writing a final data row (and a checkpoint, if CHECKPOINT_INT is set), after running for this many seconds, -1 for no limit"),
+    VALUE(DATA_SOCKET, std::string, "", "Path of a Unix domain socket to stream data file rows to as they are written, empty for none"),
+    VALUE(DATA_SOCKET_RASTER, bool, 0, "Also stream a raster of host interaction values (by cell) every DATA_INT updates? (0 for no, 1 for yes)"),
+    VALUE(JOINT_HISTOGRAMS, std::string, "", "Pairs of symbiont traits to record joint histograms of, as x:y separated by commas (e.g. int_val:efficiency,lysis_chance:inc_val). Traits: int_val, infection_chance, efficiency, lysis_chance, induction_chance, inc_val"),
+    VALUE(JOINT_HISTOGRAM_BINS, int, 10, "Number of bins along each trait of the joint histograms"),
+    VALUE(PAIR_STATS, bool, 0, "Record the covariance, correlation and mismatch of host and hosted symbiont interaction values? (0 for no, 1 for yes)"),
+    VALUE(METRICS_SHM, std::string, "", "Name of a POSIX shared-memory segment (e.g. /symbulation) to publish live metrics to every update for symbulation-top, empty for none"),
 
     GROUP(MUTATION, "Mutation"),
     VALUE(MUTATION_SIZE, double, 0.002, "Standard deviation of the distribution to mutate by"),
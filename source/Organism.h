@@ -4,6 +4,10 @@
 #include <string>
 #include "ConfigSetup.h"
 
+class CheckpointWriter;
+class CheckpointReader;
+namespace emp { class Random; }
+
 class Organism {
 
   public:
@@ -39,6 +43,9 @@ class Organism {
   virtual void SetHost(emp::Ptr<Organism> _in) {
     std::cout << "SetHost called from Organism" << std::endl;
     throw "Organism method called!";}
+  virtual void SetRandom(emp::Ptr<emp::Random> _in) {
+    std::cout << "SetRandom called from Organism" << std::endl;
+    throw "Organism method called!";}
   virtual void SetDead() {
     std::cout << "SetDead called from Organism" << std::endl;
     throw "Organism method called!";}
@@ -50,6 +57,10 @@ class Organism {
    {std::cout << "Process called from Organism" << std::endl;
      throw "Organism method called!";
   }
+  virtual void ProcessWithoutSymbionts(emp::WorldPosition location) {
+    std::cout << "ProcessWithoutSymbionts called from Organism" << std::endl;
+    throw "Organism method called!";
+  }
   virtual double GetIncVal() {
     std::cout << "GetIncVal called from Organism" << std::endl;
     throw "Organism method called!";
@@ -153,12 +164,24 @@ class Organism {
   virtual int AddSymbiont(emp::Ptr<Organism> _in)
    {std::cout << "AddSymbiont called from Organism" << std::endl;
      throw "Organism method called!";}
+  virtual bool CanAddSymbiont() {
+    std::cout << "CanAddSymbiont called from Organism" << std::endl;
+    throw "Organism method called!";}
+  virtual int AcceptSymbiont(emp::Ptr<Organism> _in) {
+    std::cout << "AcceptSymbiont called from Organism" << std::endl;
+    throw "Organism method called!";}
   virtual void AddReproSym(emp::Ptr<Organism> _in) {
     std::cout << "AddReproSym called from Organism" << std::endl;
     throw "Organism method called!";}
   virtual bool HasSym() {
     std::cout << "HasSym called from Organism" << std::endl;
     throw "Organism method called!";}
+  virtual bool GetSymbiontsChanged() {
+    std::cout << "GetSymbiontsChanged called from Organism" << std::endl;
+    throw "Organism method called!";}
+  virtual void SetSymbiontsChanged(bool _in) {
+    std::cout << "SetSymbiontsChanged called from Organism" << std::endl;
+    throw "Organism method called!";}
   virtual bool IsHost() {
     std::cout << "IsHost called from Organism" << std::endl;
     throw "Organism method called!";}
@@ -234,5 +257,13 @@ class Organism {
     std::cout << "ProcessPool called from Organism" << std::endl;
     throw "Organism method called!";}
 
+  //Checkpoint functions
+  virtual void WriteState(CheckpointWriter & writer) {
+    std::cout << "WriteState called from Organism" << std::endl;
+    throw "Organism method called!";}
+  virtual void ReadState(CheckpointReader & reader) {
+    std::cout << "ReadState called from Organism" << std::endl;
+    throw "Organism method called!";}
+
 };
 #endif
@@ -7,6 +7,23 @@
 
 #include "../test/default_mode_test/SymWorld.test.cc"
 #include "../test/default_mode_test/DataNodes.test.cc"
+#include "../test/default_mode_test/EventCounter.test.cc"
+#include "../test/default_mode_test/MetricsPage.test.cc"
+#include "../test/default_mode_test/RowStream.test.cc"
+#include "../test/default_mode_test/ReplicateAggregator.test.cc"
+#include "../test/default_mode_test/RollupDataFile.test.cc"
+#include "../test/default_mode_test/Checkpoint.test.cc"
+#include "../test/default_mode_test/Treatments.test.cc"
+#include "../test/default_mode_test/PopulationFile.test.cc"
+#include "../test/default_mode_test/BulkSetup.test.cc"
+#include "../test/default_mode_test/WorldDigest.test.cc"
+#include "../test/default_mode_test/Islands.test.cc"
+#include "../test/default_mode_test/TauLeapWorld.test.cc"
+#include "../test/default_mode_test/MeanFieldWorld.test.cc"
+#include "../test/default_mode_test/StopConditions.test.cc"
+#include "../test/default_mode_test/HostOnlyKernel.test.cc"
+#include "../test/default_mode_test/EventLog.test.cc"
+#include "../test/default_mode_test/HostedSymTable.test.cc"
 
 #include "../test/default_mode_test/Host.test.cc"
 #include "../test/default_mode_test/Symbiont.test.cc"
@@ -29,10 +46,13 @@
 #include "../test/pgg_mode_test/PGGDataNodes.test.cc"
 #include "../test/pgg_mode_test/PGGWorld.test.cc"
 
+#include "../test/aggregate_test/Aggregate.test.cc"
+
 #include "../test/integration_test/spatial_structure/vt.test.cc"
 #include "../test/integration_test/lysogeny/plr.test.cc"
 #include "../test/integration_test/endosymbiosis/res_distribute.test.cc"
 #include "../test/integration_test/dirty_transmission/hz_mut_rate.test.cc"
+#include "../test/integration_test/tau_leaping/tau_leap.test.cc"
 
 //#include "../PGGendtoend.test.cc"
 //#include "../test/end_to_end.test.cc"
@@ -0,0 +1,150 @@
+#ifndef BULK_SETUP_H
+#define BULK_SETUP_H
+
+#include "SymWorld.h"
+#include "../ConfigSetup.h"
+#include "../../Empirical/include/emp/math/Random.hpp"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <numeric>
+#include <thread>
+
+/**
+ * Input: The random number generator, the number of items and how many to pick.
+ *
+ * Output: The picked items, all different, in the order they were picked.
+ *
+ * Purpose: To sample without replacement with a partial Fisher-Yates shuffle.
+ */
+emp::vector<size_t> SampleWithoutReplacement(emp::Random & random, size_t num_items, size_t num_picks) {
+  num_picks = std::min(num_picks, num_items);
+  emp::vector<size_t> items(num_items);
+  std::iota(items.begin(), items.end(), 0);
+  for (size_t i = 0; i < num_picks; i++) {
+    std::swap(items[i], items[i + random.GetUInt(num_items - i)]);
+  }
+  items.resize(num_picks);
+  return items;
+}
+
+/**
+ * Input: The number of items, the function that builds one chunk of them (given the
+ * chunk's first and past-the-end item and its own random number generator), and the
+ * world's random number generator, which seeds the chunks.
+ *
+ * Output: None
+ *
+ * Purpose: To build items in parallel chunks. Each chunk's generator is seeded up
+ * front, so what is built does not depend on how many threads build it. Errors
+ * thrown while building are rethrown once every thread is done.
+ */
+template <typename BUILD_CHUNK>
+void BuildInChunks(size_t num_items, BUILD_CHUNK build_chunk, emp::Random & random) {
+  const size_t CHUNK_SIZE = 1 << 14;
+  size_t num_chunks = (num_items + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  emp::vector<int> seeds(num_chunks);
+  for (int & seed : seeds) seed = random.GetInt(1, INT_MAX);
+
+  std::atomic<size_t> next{0};
+  emp::vector<const char *> errors(num_chunks, nullptr);
+  auto worker = [&](){
+    for (size_t c = next++; c < num_chunks; c = next++) {
+      emp::Random chunk_random(seeds[c]);
+      try {
+        build_chunk(c * CHUNK_SIZE, std::min(num_items, (c + 1) * CHUNK_SIZE), chunk_random);
+      } catch (const char * error) {
+        errors[c] = error;
+      }
+    }
+  };
+  size_t num_threads = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), num_chunks));
+  emp::vector<std::thread> threads;
+  for (size_t t = 1; t < num_threads; t++) threads.emplace_back(worker);
+  worker();
+  for (std::thread & thread : threads) thread.join();
+  for (const char * error : errors) if (error) throw error;
+}
+
+/**
+ * Input: The world, its settings, and functions that make a host and a symbiont of
+ * the world's mode from a random number generator and an interaction value.
+ *
+ * Output: None
+ *
+ * Purpose: To build the starting population of a large world quickly (BULK_SETUP).
+ * The world is sized once, POP_SIZE hosts go to distinct cells (random ones on a
+ * grid, the first ones otherwise), and the POP_SIZE * START_MOI symbionts are dealt
+ * out to distinct hosts, round by round, or with FREE_LIVING_SYMS to distinct cells,
+ * so none are lost on empty cells. Hosts and symbionts are built in parallel, each
+ * chunk with its own generator, and then placed in order. Interaction values follow
+ * HOST_INT, SYM_INT and COMPETITION_MODE as in the one-at-a-time setup, but the
+ * population itself differs from that setup's.
+ */
+template <typename MAKE_HOST, typename MAKE_SYM>
+void BulkPopulationSetup(emp::Ptr<SymWorld> world, emp::Ptr<SymConfigBase> my_config,
+                         MAKE_HOST make_host, MAKE_SYM make_sym) {
+  emp::Random & random = world->GetRandom();
+  size_t num_cells = my_config->GRID_X() * my_config->GRID_Y();
+  size_t pop_size = my_config->POP_SIZE() == -1 ? num_cells : std::min<size_t>(my_config->POP_SIZE(), num_cells);
+  size_t total_syms = pop_size * my_config->START_MOI();
+  bool random_phen_host = my_config->HOST_INT() == -2 && !my_config->COMPETITION_MODE();
+  bool random_phen_sym = my_config->SYM_INT() == -2;
+  world->Resize(my_config->GRID_X(), my_config->GRID_Y());
+
+  emp::vector<size_t> host_cells;
+  if (my_config->GRID() && pop_size < num_cells) host_cells = SampleWithoutReplacement(random, num_cells, pop_size);
+  else {
+    host_cells.resize(pop_size);
+    std::iota(host_cells.begin(), host_cells.end(), 0);
+  }
+
+  emp::vector<size_t> sym_counts(pop_size, 0);
+  emp::vector<size_t> free_sym_cells;
+  if (my_config->FREE_LIVING_SYMS() == 0) {
+    if (pop_size > 0) {
+      for (size_t & count : sym_counts) count = total_syms / pop_size;
+      for (size_t host_id : SampleWithoutReplacement(random, pop_size, total_syms % pop_size)) sym_counts[host_id]++;
+    }
+  } else {
+    free_sym_cells = SampleWithoutReplacement(random, num_cells, total_syms);
+  }
+
+  auto sym_int_val = [&](emp::Random & chunk_random){
+    return random_phen_sym ? chunk_random.GetDouble(-1, 1) : my_config->SYM_INT();
+  };
+
+  emp::vector<emp::Ptr<Organism>> hosts(pop_size);
+  BuildInChunks(pop_size, [&](size_t first, size_t last, emp::Random & chunk_random){
+    for (size_t i = first; i < last; i++) {
+      double host_int_val = my_config->HOST_INT();
+      if (random_phen_host) host_int_val = chunk_random.GetDouble(-1, 1);
+      else if (my_config->COMPETITION_MODE()) host_int_val = i%2 == 0 ? 0 : 0.95;
+      hosts[i] = make_host(chunk_random, host_int_val);
+      for (size_t j = 0; j < sym_counts[i]; j++) hosts[i]->AddSymbiont(make_sym(chunk_random, sym_int_val(chunk_random)));
+      // the chunk's generator goes away with the chunk
+      hosts[i]->SetRandom(&random);
+      for (emp::Ptr<Organism> sym : hosts[i]->GetSymbionts()) sym->SetRandom(&random);
+    }
+  }, random);
+
+  emp::vector<emp::Ptr<Organism>> free_syms(free_sym_cells.size());
+  BuildInChunks(free_syms.size(), [&](size_t first, size_t last, emp::Random & chunk_random){
+    for (size_t i = first; i < last; i++) {
+      free_syms[i] = make_sym(chunk_random, sym_int_val(chunk_random));
+      free_syms[i]->SetRandom(&random);
+    }
+  }, random);
+
+  for (size_t i = 0; i < pop_size; i++) {
+    world->AddOrgAt(hosts[i], emp::WorldPosition(host_cells[i]));
+    if (my_config->PHYLOGENY()) {
+      for (emp::Ptr<Organism> sym : hosts[i]->GetSymbionts()) world->AddSymToSystematic(sym);
+    }
+  }
+  for (size_t i = 0; i < free_syms.size(); i++) {
+    if (my_config->PHYLOGENY()) world->AddSymToSystematic(free_syms[i]);
+    world->AddOrgAt(free_syms[i], emp::WorldPosition(0, free_sym_cells[i]));
+  }
+}
+#endif
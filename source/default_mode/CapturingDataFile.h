@@ -0,0 +1,108 @@
+#ifndef CAPTURING_DATA_FILE_H
+#define CAPTURING_DATA_FILE_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../../Empirical/include/emp/data/DataFile.hpp"
+#include <functional>
+#include <sstream>
+#include <string>
+
+/**
+  *
+  * Purpose: A DataFile whose rows (and header) can be captured as text as they are
+  * written, so subclasses can pass them on, e.g. to a ReplicateAggregator. Every
+  * captured line is also passed to the file's line functions (e.g. to stream it to a
+  * RowStream), so those work alongside whatever the subclass does with the line.
+  *
+*/
+class CapturingDataFile : public emp::DataFile {
+public:
+  using line_fun_t = std::function<void(const std::string & line, bool is_header)>;
+
+private:
+  emp::vector<line_fun_t> line_funs;
+
+protected:
+  /**
+   * Input: The function that writes a line to the file, and whether the line should
+   * still reach the file (defaults to true).
+   *
+   * Output: The line that was written, without its line ending.
+   *
+   * Purpose: To capture a line as it is written.
+   */
+  template <typename FUN>
+  std::string Capture(FUN write_line, bool write_to_file=true) {
+    std::ostream * file_os = os;
+    std::stringstream line;
+    os = &line;
+    write_line();
+    os = file_os;
+    std::string text = line.str();
+    if (write_to_file) {
+      *os << text;
+      os->flush();
+    }
+    if (!text.empty() && text.back() == '\n') text.pop_back();
+    return text;
+  }
+
+  /**
+   * Input: Whether the header should still reach the file (defaults to true).
+   *
+   * Output: The header that was written, without its line ending.
+   *
+   * Purpose: To capture the header as it is written and pass it to the line functions.
+   */
+  std::string CaptureHeader(bool write_to_file=true) {
+    std::string header = Capture([this](){ emp::DataFile::PrintHeaderKeys(); }, write_to_file);
+    for (const line_fun_t & fun : line_funs) fun(header, true);
+    return header;
+  }
+
+  /**
+   * Input: Whether the row should still reach the file (defaults to true).
+   *
+   * Output: The row that was written, without its line ending.
+   *
+   * Purpose: To capture a row as it is written and pass it to the line functions.
+   */
+  std::string CaptureRow(bool write_to_file=true) {
+    std::string row = Capture([this](){ emp::DataFile::Update(); }, write_to_file);
+    for (const line_fun_t & fun : line_funs) fun(row, false);
+    return row;
+  }
+
+public:
+  /**
+   * Input: None
+   *
+   * Output: A stream that discards everything written to it.
+   *
+   * Purpose: To back files whose rows are only captured, never written to disk.
+   */
+  static std::ostream & GetNullStream() {
+    static std::ostream null_os(nullptr);
+    return null_os;
+  }
+
+  CapturingDataFile(const std::string & filename) : emp::DataFile(filename) {}
+  CapturingDataFile(std::ostream & out) : emp::DataFile(out) {}
+
+  /**
+   * Input: The function to call with each line the file writes from now on, and
+   * whether that line is the header.
+   *
+   * Output: None
+   *
+   * Purpose: To pass the file's lines on, whichever subclass of file it is.
+   */
+  void AddLineFun(const line_fun_t & fun) { line_funs.push_back(fun); }
+
+  void PrintHeaderKeys() override { CaptureHeader(); }
+
+  void Update() override { CaptureRow(); }
+
+  using emp::DataFile::Update;
+};
+#endif
@@ -0,0 +1,242 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "CapturingDataFile.h"
+#include "EventCounter.h"
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+/**
+  *
+  * Purpose: Identifies a checkpoint file and the version of its layout. The version
+  * must be bumped whenever what is written (or its order) changes.
+  *
+*/
+constexpr uint64_t CHECKPOINT_MAGIC = 0x53594d434b505431; // "SYMCKPT1"
+constexpr uint32_t CHECKPOINT_VERSION = 3;
+
+/**
+  *
+  * Purpose: Writes the fields of a checkpoint as raw binary values.
+  *
+*/
+class CheckpointWriter {
+private:
+  std::ostream & os;
+
+public:
+  CheckpointWriter(std::ostream & _os) : os(_os) {}
+
+  /**
+   * Input: A plain value (number, bool, or other trivially copyable type).
+   *
+   * Output: None
+   *
+   * Purpose: To write one value as it is laid out in memory.
+   */
+  template <typename T>
+  void Write(const T & value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be written to a checkpoint");
+    os.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  /**
+   * Input: A string.
+   *
+   * Output: None
+   *
+   * Purpose: To write a string as its length followed by its characters.
+   */
+  void WriteString(const std::string & value) {
+    Write<uint64_t>(value.size());
+    os.write(value.data(), value.size());
+  }
+
+  /**
+   * Input: The start and size of a block of memory.
+   *
+   * Output: None
+   *
+   * Purpose: To write a block of memory as it is, preceded by its size.
+   */
+  void WriteBytes(const void * data, size_t size) {
+    Write<uint64_t>(size);
+    os.write(static_cast<const char *>(data), size);
+  }
+
+  bool Good() const { return os.good(); }
+};
+
+/**
+  *
+  * Purpose: Reads back the fields written by a CheckpointWriter, in the same order.
+  * Throws if the file ends early.
+  *
+*/
+class CheckpointReader {
+private:
+  std::istream & is;
+
+public:
+  CheckpointReader(std::istream & _is) : is(_is) {}
+
+  /**
+   * Input: None
+   *
+   * Output: The next value, of the type it was written as.
+   *
+   * Purpose: To read one plain value.
+   */
+  template <typename T>
+  T Read() {
+    static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be read from a checkpoint");
+    T value;
+    is.read(reinterpret_cast<char *>(&value), sizeof(T));
+    if (!is) throw "Checkpoint file is truncated";
+    return value;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The next string.
+   *
+   * Purpose: To read a string written by WriteString.
+   */
+  std::string ReadString() {
+    std::string value(Read<uint64_t>(), '\0');
+    is.read(&value[0], value.size());
+    if (!is) throw "Checkpoint file is truncated";
+    return value;
+  }
+
+  /**
+   * Input: Where to put the block and its expected size.
+   *
+   * Output: None
+   *
+   * Purpose: To read a block written by WriteBytes, which must have the same size.
+   */
+  void ReadBytes(void * data, size_t size) {
+    if (Read<uint64_t>() != size) throw "Checkpoint was written by an incompatible build";
+    is.read(static_cast<char *>(data), size);
+    if (!is) throw "Checkpoint file is truncated";
+  }
+};
+
+/**
+ * Input: The checkpoint reader, at the start of the file.
+ *
+ * Output: None
+ *
+ * Purpose: To check that the file is a checkpoint of the current layout.
+ */
+void ReadCheckpointHeader(CheckpointReader & reader) {
+  if (reader.Read<uint64_t>() != CHECKPOINT_MAGIC) throw "Not a checkpoint file";
+  if (reader.Read<uint32_t>() != CHECKPOINT_VERSION) throw "Checkpoint file was written by a different version";
+}
+
+/**
+ * Input: The name of a file.
+ *
+ * Output: Whether the file starts like a checkpoint.
+ *
+ * Purpose: To tell checkpoints apart from other population files.
+ */
+bool IsCheckpointFile(const std::string & filename) {
+  std::ifstream in(filename, std::ios::binary);
+  uint64_t magic = 0;
+  in.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+  return in && magic == CHECKPOINT_MAGIC;
+}
+
+/**
+ * Input: The checkpoint writer and an event counter.
+ *
+ * Output: None
+ *
+ * Purpose: To save a counter's count and total and how much of them has been reported.
+ */
+void WriteCounter(CheckpointWriter & writer, const EventCounter & counter) {
+  writer.Write<uint64_t>(counter.GetCount());
+  writer.Write<uint64_t>(counter.GetTotal());
+  writer.Write<uint64_t>(counter.GetReportedCount());
+  writer.Write<uint64_t>(counter.GetReportedTotal());
+}
+
+/**
+ * Input: The checkpoint reader and an event counter.
+ *
+ * Output: None
+ *
+ * Purpose: To restore a counter saved by WriteCounter.
+ */
+void ReadCounter(CheckpointReader & reader, EventCounter & counter) {
+  size_t count = reader.Read<uint64_t>();
+  size_t total = reader.Read<uint64_t>();
+  size_t reported_count = reader.Read<uint64_t>();
+  size_t reported_total = reader.Read<uint64_t>();
+  counter.Restore(count, total, reported_count, reported_total);
+}
+
+/**
+ * Input: The name of an output file and how many bytes of it to keep.
+ *
+ * Output: The first bytes of the file (fewer if it is shorter).
+ *
+ * Purpose: To recover what a run had written to a file when its checkpoint was
+ * saved, so the resumed run continues the file instead of starting it over.
+ */
+std::string ReadFilePrefix(const std::string & filename, size_t length) {
+  std::ifstream in(filename, std::ios::binary);
+  std::string prefix(length, '\0');
+  in.read(&prefix[0], length);
+  prefix.resize(in.gcount());
+  return prefix;
+}
+
+/**
+  *
+  * Purpose: A DataFile that knows how many bytes it has written, so a checkpoint can
+  * record it, and that can continue a file from a resumed checkpoint (in which case
+  * the header is already there and is not written again).
+  *
+*/
+class CheckpointDataFile : public CapturingDataFile {
+private:
+  size_t bytes_written = 0;
+  bool resumed = false;
+
+public:
+  /**
+   * Input: The file's name and what the run had written to it when its checkpoint
+   * was saved (empty for a new file).
+   *
+   * Output: None
+   *
+   * Purpose: To open the file, restoring its previous contents.
+   */
+  CheckpointDataFile(const std::string & filename, const std::string & prefix = "")
+    : CapturingDataFile(filename), bytes_written(prefix.size()), resumed(!prefix.empty()) {
+    *os << prefix;
+    os->flush();
+  }
+
+  size_t GetBytesWritten() const { return bytes_written; }
+
+  void PrintHeaderKeys() override {
+    if (resumed) return;
+    bytes_written += CaptureHeader().size() + 1;
+  }
+
+  void Update() override {
+    bytes_written += CaptureRow().size() + 1;
+  }
+
+  using emp::DataFile::Update;
+};
+#endif
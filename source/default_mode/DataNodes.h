@@ -14,6 +14,12 @@ void SymWorld::CreateDateFiles(){
   int TIMING_REPEAT = my_config->DATA_INT();
   std::string file_ending = "_SEED"+std::to_string(my_config->SEED())+".data";
 
+  CheckOutputSettings();
+
+  if(my_config->DATA_SOCKET() != ""){
+    SetupRowStream(my_config->DATA_SOCKET());
+  }
+
   SetupHostIntValFile(my_config->FILE_PATH()+"HostVals"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
   SetupSymIntValFile(my_config->FILE_PATH()+"SymVals"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
   SetUpTransmissionFile(my_config->FILE_PATH()+"TransmissionRates"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
@@ -21,6 +27,70 @@ void SymWorld::CreateDateFiles(){
   if(my_config->FREE_LIVING_SYMS() == 1){
     SetUpFreeLivingSymFile(my_config->FILE_PATH()+"FreeLivingSyms_"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
   }
+
+  if(my_config->PAIR_STATS() == 1){
+    SetupPairStatsFile(my_config->FILE_PATH()+"HostSymPairs"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
+  }
+
+  if(my_config->JOINT_HISTOGRAMS() != ""){
+    SetupJointHistograms(my_config->FILE_PATH()+"JointHistograms"+my_config->FILE_NAME()+file_ending);
+  }
+
+  if(my_config->METRICS_SHM() != ""){
+    SetupMetricsPage(my_config->METRICS_SHM());
+  }
+
+  if(my_config->DIGEST_INT() > 0){
+    SetupDigestFile(my_config->FILE_PATH()+"Digest"+my_config->FILE_NAME()+file_ending);
+  }
+}
+
+/**
+* Input: None.
+*
+* Output: None.
+*
+* Purpose: To set up the data files that can be rebuilt from an event log (see
+* ReplayEventLog): those computed only from where organisms are and their interaction
+* values and infection chances.
+*/
+void SymWorld::CreateReplayDataFiles(){
+  int TIMING_REPEAT = my_config->DATA_INT();
+  std::string file_ending = "_SEED"+std::to_string(my_config->SEED())+".data";
+
+  SetupHostIntValFile(my_config->FILE_PATH()+"HostVals"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
+  SetupSymIntValFile(my_config->FILE_PATH()+"SymVals"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
+
+  if(my_config->FREE_LIVING_SYMS() == 1){
+    SetUpFreeLivingSymFile(my_config->FILE_PATH()+"FreeLivingSyms_"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
+  }
+
+  if(my_config->PAIR_STATS() == 1){
+    SetupPairStatsFile(my_config->FILE_PATH()+"HostSymPairs"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
+  }
+
+  if(my_config->JOINT_HISTOGRAMS() != ""){
+    SetupJointHistograms(my_config->FILE_PATH()+"JointHistograms"+my_config->FILE_NAME()+file_ending);
+  }
+}
+
+/**
+* Input: The name of the file to write the joint histograms to.
+*
+* Output: None.
+*
+* Purpose: To start the joint histograms listed in JOINT_HISTOGRAMS, as x:y trait
+* pairs separated by commas, and set up their file.
+*/
+void SymWorld::SetupJointHistograms(const std::string & filename){
+  std::stringstream pairs(my_config->JOINT_HISTOGRAMS());
+  std::string pair;
+  while(std::getline(pairs, pair, ',')){
+    size_t colon = pair.find(':');
+    if(colon == std::string::npos) throw "JOINT_HISTOGRAMS entries must be trait pairs written x:y";
+    AddJointHistogram(pair.substr(0, colon), pair.substr(colon + 1), my_config->JOINT_HISTOGRAM_BINS());
+  }
+  SetupJointHistogramFile(filename);
 }
 
 /**
@@ -211,12 +281,20 @@ emp::DataFile & SymWorld::SetUpTransmissionFile(const std::string & filename){
 
   file.AddVar(update, "update", "Update");
 
+  //the event counters are cumulative (the metrics page reads them too), so before
+  //each row the file closes off the events since the previous row for its columns
+  file.AddPreFun([&node1, &node2, &node3](){
+    node1.MarkReported();
+    node2.MarkReported();
+    node3.MarkReported();
+  });
+
   //horizontal transmission
-  file.AddTotal(node1, "attempts_horiztrans", "Total number of horizontal transmission attempts", true);
-  file.AddTotal(node2, "successes_horiztrans", "Total number of horizontal transmission successes", true);
+  file.AddFun<size_t>([&node1](){ return node1.GetLastReportTotal(); }, "attempts_horiztrans", "Total number of horizontal transmission attempts");
+  file.AddFun<size_t>([&node2](){ return node2.GetLastReportTotal(); }, "successes_horiztrans", "Total number of horizontal transmission successes");
 
   //vertical transmission
-  file.AddTotal(node3, "attempts_verttrans", "Total number of horizontal transmission attempts", true);
+  file.AddFun<size_t>([&node3](){ return node3.GetLastReportTotal(); }, "attempts_verttrans", "Total number of horizontal transmission attempts");
 
   file.PrintHeaderKeys();
 
@@ -224,6 +302,35 @@ emp::DataFile & SymWorld::SetUpTransmissionFile(const std::string & filename){
 }
 
 
+/**
+ * Input: The address of the string representing the file to be created's name
+ *
+ * Output: The address of the DataFile that has been created.
+ *
+ * Purpose: To set up the file the world digest is written to, every DIGEST_INT
+ * updates, as update,digest rows. symbulation-digest-compare finds the first update
+ * two such files differ on. The file is written by the host traversal rather than
+ * on the data files' timing, and is never streamed, aggregated or rolled up, so
+ * that it has one row for every digest taken.
+ */
+emp::DataFile & SymWorld::SetupDigestFile(const std::string & filename) {
+  if (digest_file) digest_file.Delete();
+  if (my_config->CHECKPOINT_INT() > 0) {
+    std::string prefix;
+    if (resume_lengths.count(filename)) prefix = ReadFilePrefix(filename, resume_lengths[filename]);
+    emp::Ptr<CheckpointDataFile> file = emp::NewPtr<CheckpointDataFile>(filename, prefix);
+    checkpoint_files.push_back(file);
+    digest_file = file;
+  } else {
+    digest_file = emp::NewPtr<emp::DataFile>(filename);
+  }
+  GetHostIntValDataNode();
+  digest_file->AddVar(digest_update, "update", "Update the digest was taken at");
+  digest_file->AddFun<std::string>([this](){return FormatDigest(world_digest);}, "digest", "Digest of the world's state up to this update");
+  digest_file->PrintHeaderKeys();
+  return *digest_file;
+}
+
 /**
  * Input: None
  *
@@ -247,6 +354,24 @@ emp::DataMonitor<int>& SymWorld::GetHostCountDataNode() {
 }
 
 
+/**
+ * Input: None
+ *
+ * Output: The HostedSymTable& of the population as it is now.
+ *
+ * Purpose: To get the contiguous table of hosted symbionts, making it the first
+ * time a data node asks for it. The table is stamped with the update it was built
+ * at and rebuilt whenever that is not the current update (the update counter moves
+ * on every time organisms are processed), so every data node that asks gets an up
+ * to date table, whenever and in whatever order the data nodes run.
+ */
+HostedSymTable & SymWorld::UseHostedSymTable() {
+  if (!hosted_sym_table) hosted_sym_table.New();
+  if (!hosted_sym_table->IsBuiltAt(update)) hosted_sym_table->Build(pop, update);
+  return *hosted_sym_table;
+}
+
+
 /**
  * Input: None
  *
@@ -260,10 +385,11 @@ emp::DataMonitor<int>& SymWorld::GetSymCountDataNode() {
   if(!data_node_symcount) {
     data_node_symcount.New();
     OnUpdate([this](size_t){
+      HostedSymTable & table = UseHostedSymTable();
       data_node_symcount -> Reset();
       for (size_t i = 0; i < pop.size(); i++){
         if(IsOccupied(i)){
-          data_node_symcount->AddDatum((pop[i]->GetSymbionts()).size());
+          data_node_symcount->AddDatum(table.GetCount(i));
         }
         if(sym_pop[i]){
           data_node_symcount->AddDatum(1);
@@ -288,10 +414,11 @@ emp::DataMonitor<int>& SymWorld::GetCountHostedSymsDataNode(){
   if (!data_node_hostedsymcount) {
     data_node_hostedsymcount.New();
     OnUpdate([this](size_t){
+      HostedSymTable & table = UseHostedSymTable();
       data_node_hostedsymcount->Reset();
       for (size_t i = 0; i< pop.size(); i++)
         if (IsOccupied(i))
-          data_node_hostedsymcount->AddDatum(pop[i]->GetSymbionts().size());
+          data_node_hostedsymcount->AddDatum(table.GetCount(i));
     });
   }
   return *data_node_hostedsymcount;
@@ -335,11 +462,12 @@ emp::DataMonitor<int>& SymWorld::GetUninfectedHostsDataNode() {
   if(!data_node_uninf_hosts) {
     data_node_uninf_hosts.New();
     OnUpdate([this](size_t){
+      HostedSymTable & table = UseHostedSymTable();
   data_node_uninf_hosts -> Reset();
 
   for (size_t i = 0; i < pop.size(); i++) {
     if(IsOccupied(i)) {
-      if((pop[i]->GetSymbionts()).empty()) {
+      if(table.GetCount(i) == 0) {
         data_node_uninf_hosts->AddDatum(1);
       }
     } //endif
@@ -364,11 +492,32 @@ emp::DataMonitor<int>& SymWorld::GetUninfectedHostsDataNode() {
 emp::DataMonitor<double, emp::data::Histogram>& SymWorld::GetHostIntValDataNode() {
   if (!data_node_hostintval) {
     data_node_hostintval.New();
+    //this is the host traversal; host-symbiont pair statistics and the world digest are filled here too
     OnUpdate([this](size_t){
+      HostedSymTable & table = UseHostedSymTable();
       data_node_hostintval->Reset();
-      for (size_t i = 0; i< pop.size(); i++)
-        if (IsOccupied(i))
+      for (emp::Ptr<PairStats> stats : pair_stats) stats->Reset();
+      size_t num_pair_stats = pair_stats.size();
+      emp::Ptr<WorldDigest> digest;
+      if (digest_file && update % std::max(my_config->DIGEST_INT(), 1) == 0) digest.New(world_digest, update);
+      for (size_t i = 0; i< pop.size(); i++) {
+        if (digest && sym_pop[i]) digest->AddOrganism(true, i, *sym_pop[i]);
+        if (IsOccupied(i)) {
           data_node_hostintval->AddDatum(pop[i]->GetIntVal());
+          if (digest) digest->AddOrganism(false, i, *pop[i]);
+          if (num_pair_stats == 0) continue;
+          for(size_t j = table.Begin(i); j < table.End(i); j++){
+            for (size_t k = 0; k < num_pair_stats; k++) pair_stats[k]->AddPair(*pop[i], *table.GetSym(j));
+          }
+        }
+      }
+      if (digest) {
+        digest->AddRandom(GetRandom());
+        world_digest = digest->Get();
+        digest_update = update;
+        digest_file->Update();
+        digest.Delete();
+      }
     });
   }
   data_node_hostintval->SetupBins(-1.0, 1.1, 21);
@@ -389,13 +538,12 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetSymIntValDataNode()
   if (!data_node_symintval) {
     data_node_symintval.New();
     OnUpdate([this](size_t){
+      HostedSymTable & table = UseHostedSymTable();
       data_node_symintval->Reset();
       for (size_t i = 0; i< pop.size(); i++) {
         if (IsOccupied(i)) {
-          emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-          size_t sym_size = syms.size();
-          for(size_t j=0; j< sym_size; j++){
-            data_node_symintval->AddDatum(syms[j]->GetIntVal());
+          for(size_t j = table.Begin(i); j < table.End(i); j++){
+            data_node_symintval->AddDatum(table.GetIntVal(j));
           }//close for
         }
         if (sym_pop[i]) {
@@ -447,13 +595,12 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetHostedSymIntValDataN
   if (!data_node_hostedsymintval) {
     data_node_hostedsymintval.New();
     OnUpdate([this](size_t){
+      HostedSymTable & table = UseHostedSymTable();
       data_node_hostedsymintval->Reset();
       for (size_t i = 0; i< pop.size(); i++) {
         if (IsOccupied(i)) {
-          emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-          size_t sym_size = syms.size();
-          for(size_t j=0; j< sym_size; j++){
-            data_node_hostedsymintval->AddDatum(syms[j]->GetIntVal());
+          for(size_t j = table.Begin(i); j < table.End(i); j++){
+            data_node_hostedsymintval->AddDatum(table.GetIntVal(j));
           }//close for
         }//close if
       }//close for
@@ -477,13 +624,12 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetSymInfectChanceDataN
   if (!data_node_syminfectchance) {
     data_node_syminfectchance.New();
     OnUpdate([this](size_t){
+      HostedSymTable & table = UseHostedSymTable();
       data_node_syminfectchance->Reset();
       for (size_t i = 0; i< pop.size(); i++) {
         if (IsOccupied(i)) {
-          emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-          size_t sym_size = syms.size();
-          for(size_t j=0; j< sym_size; j++){
-            data_node_syminfectchance->AddDatum(syms[j]->GetInfectionChance());
+          for(size_t j = table.Begin(i); j < table.End(i); j++){
+            data_node_syminfectchance->AddDatum(table.GetInfectionChance(j));
           }//close for
         }
         if (sym_pop[i]) {
@@ -537,13 +683,12 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetHostedSymInfectChanc
   if (!data_node_hostedsyminfectchance) {
     data_node_hostedsyminfectchance.New();
     OnUpdate([this](size_t){
+      HostedSymTable & table = UseHostedSymTable();
       data_node_hostedsyminfectchance->Reset();
       for (size_t i = 0; i< pop.size(); i++) {
         if (IsOccupied(i)) {
-          emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-          size_t sym_size = syms.size();
-          for(size_t j=0; j< sym_size; j++){
-            data_node_hostedsyminfectchance->AddDatum(syms[j]->GetInfectionChance());
+          for(size_t j = table.Begin(i); j < table.End(i); j++){
+            data_node_hostedsyminfectchance->AddDatum(table.GetInfectionChance(j));
           }//close for
         }
       }//close for
@@ -554,16 +699,160 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetHostedSymInfectChanc
 }
 
 
+/**
+ * Input: How to read the paired trait from hosts and from symbionts, and the range
+ * and number of bins of the mismatch histogram.
+ *
+ * Output: The PairStats& that will be filled each update.
+ *
+ * Purpose: To start recording statistics over every host and hosted symbiont pair.
+ * They are filled during the host interaction value traversal, so they add no scan
+ * of their own.
+ */
+PairStats & SymWorld::AddPairStats(std::function<double(Organism &)> host_trait, std::function<double(Organism &)> sym_trait, double mismatch_min, double mismatch_max, size_t mismatch_bins) {
+  GetHostIntValDataNode(); //make sure the host traversal exists
+  pair_stats.push_back(emp::NewPtr<PairStats>(host_trait, sym_trait, mismatch_min, mismatch_max, mismatch_bins));
+  return *pair_stats.back();
+}
+
+
 /**
  * Input: None
  *
- * Output: The DataMonitor<int>& that has the information representing
+ * Output: The PairStats& that has the information representing how host
+ * interaction values relate to the interaction values of their symbionts.
+ *
+ * Purpose: To collect data on partner fidelity.
+ */
+PairStats & SymWorld::GetIntValPairDataNode() {
+  if (!data_node_intval_pairs) {
+    data_node_intval_pairs = &AddPairStats([](Organism & org){ return org.GetIntVal(); },
+      [](Organism & org){ return org.GetIntVal(); }, 0, 2.1, 21);
+  }
+  return *data_node_intval_pairs;
+}
+
+
+/**
+ * Input: The address of the string representing the file to be
+ * created's name
+ *
+ * Output: The address of the DataFile that has been created.
+ *
+ * Purpose: To set up the file that will be used to track host-symbiont
+ * interaction value pairs: the number of pairs, their covariance and
+ * correlation, and the mean and histogram of their mismatch.
+ */
+emp::DataFile & SymWorld::SetupPairStatsFile(const std::string & filename) {
+  auto & file = SetupFile(filename);
+  auto & pairs = GetIntValPairDataNode();
+  auto & node = pairs.GetMismatchDataNode();
+
+  file.AddVar(update, "update", "Update");
+  file.AddFun<size_t>([&pairs](){ return pairs.GetCount(); }, "pairs", "Number of host-symbiont pairs");
+  file.AddFun<double>([&pairs](){ return pairs.GetCovariance(); }, "intval_covariance", "Covariance of host and symbiont interaction values");
+  file.AddFun<double>([&pairs](){ return pairs.GetCorrelation(); }, "intval_correlation", "Correlation of host and symbiont interaction values");
+  file.AddMean(node, "mean_intval_mismatch", "Average absolute difference between host and symbiont interaction values");
+  for (size_t i = 0; i < 21; i++) {
+    std::stringstream bin, next_bin;
+    bin << i / 10.0;
+    next_bin << (i + 1) / 10.0;
+    file.AddHistBin(node, i, "Hist_" + bin.str(), "Count for histogram bin " + bin.str() + " to <" + next_bin.str());
+  }
+  file.PrintHeaderKeys();
+
+  return file;
+}
+
+
+/**
+ * Input: The name of a symbiont trait.
+ *
+ * Output: The SymTrait describing how to read and bin that trait.
+ *
+ * Purpose: To look up the traits joint histograms can be recorded over.
+ * Traits of other modes (e.g. efficiency) must only be used in those modes.
+ */
+SymTrait SymWorld::GetSymTrait(const std::string & name) {
+  if (name == "int_val") return {name, [](Organism & org){ return org.GetIntVal(); }, -1.0, 1.0};
+  if (name == "infection_chance") return {name, [](Organism & org){ return org.GetInfectionChance(); }, 0.0, 1.0};
+  if (name == "efficiency") return {name, [](Organism & org){ return org.GetEfficiency(); }, 0.0, 1.0};
+  if (name == "lysis_chance") return {name, [](Organism & org){ return org.GetLysisChance(); }, 0.0, 1.0};
+  if (name == "induction_chance") return {name, [](Organism & org){ return org.GetInductionChance(); }, 0.0, 1.0};
+  if (name == "inc_val") return {name, [](Organism & org){ return org.GetIncVal(); }, 0.0, 1.0};
+  throw "Unknown symbiont trait for a joint histogram. Must be int_val, infection_chance, efficiency, lysis_chance, induction_chance, or inc_val";
+}
+
+
+/**
+ * Input: The names of the two symbiont traits, and the number of bins along each.
+ *
+ * Output: The JointHistogram& that will be filled each update.
+ *
+ * Purpose: To start recording a joint histogram of two symbiont traits. All
+ * joint histograms are filled together in a single pass over the hosted and
+ * free-living symbionts.
+ */
+JointHistogram & SymWorld::AddJointHistogram(const std::string & x_trait, const std::string & y_trait, size_t bins) {
+  if (joint_histograms.size() == 0) {
+    OnUpdate([this](size_t){
+      HostedSymTable & table = UseHostedSymTable();
+      for (emp::Ptr<JointHistogram> hist : joint_histograms) hist->Reset();
+      size_t num_hists = joint_histograms.size();
+      for (size_t i = 0; i < pop.size(); i++) {
+        if (IsOccupied(i)) {
+          for(size_t j = table.Begin(i); j < table.End(i); j++){
+            for (size_t k = 0; k < num_hists; k++) joint_histograms[k]->AddOrg(*table.GetSym(j));
+          }//close for
+        }
+        if (sym_pop[i]) {
+          for (size_t k = 0; k < num_hists; k++) joint_histograms[k]->AddOrg(*sym_pop[i]);
+        } //close if
+      }//close for
+    });
+  }
+  joint_histograms.push_back(emp::NewPtr<JointHistogram>(GetSymTrait(x_trait), GetSymTrait(y_trait), bins, bins));
+  return *joint_histograms.back();
+}
+
+
+/**
+ * Input: The address of the string representing the file to be
+ * created's name
+ *
+ * Output: None
+ *
+ * Purpose: To write the joint histograms every DATA_INT updates, as sparse
+ * "update,x_trait,y_trait,bin_x,bin_y,count" rows (empty bins are left out).
+ * The joint histograms must be added before this is called.
+ */
+void SymWorld::SetupJointHistogramFile(const std::string & filename) {
+  std::string prefix; //what a resumed run had written to the file
+  if (resume_lengths.count(filename)) prefix = ReadFilePrefix(filename, resume_lengths[filename]);
+  emp::Ptr<std::ofstream> file = emp::NewPtr<std::ofstream>(filename);
+  if (prefix != "") *file << prefix;
+  else *file << "update,x_trait,y_trait,bin_x,bin_y,count" << std::endl;
+  int data_int = my_config->DATA_INT();
+  OnUpdate([this, file, data_int](size_t ud){
+    if (ud % data_int != 0) return;
+    for (emp::Ptr<JointHistogram> hist : joint_histograms) hist->WriteSparse(*file, ud);
+    file->flush();
+  });
+  joint_histogram_files.push_back(file);
+  joint_histogram_filenames.push_back(filename);
+}
+
+
+/**
+ * Input: None
+ *
+ * Output: The EventCounter& that has the information representing
  * how many attempts were made to horizontally transmit.
  *
  * Purpose: To retrieve the data nodes that is tracking the
  * number of attempted horizontal transmissions.
  */
-emp::DataMonitor<int>& SymWorld::GetHorizontalTransmissionAttemptCount() {
+EventCounter& SymWorld::GetHorizontalTransmissionAttemptCount() {
   if (!data_node_attempts_horiztrans) {
     data_node_attempts_horiztrans.New();
   }
@@ -574,13 +863,13 @@ emp::DataMonitor<int>& SymWorld::GetHorizontalTransmissionAttemptCount() {
 /**
  * Input: None
  *
- * Output: The DataMonitor<int>& that has the information representing
+ * Output: The EventCounter& that has the information representing
  * how many successful attempts were made to horizontally transmit.
  *
  * Purpose: To retrieve the data nodes that is tracking the
  * number of successful horizontal transmissions.
  */
-emp::DataMonitor<int>& SymWorld::GetHorizontalTransmissionSuccessCount() {
+EventCounter& SymWorld::GetHorizontalTransmissionSuccessCount() {
   if (!data_node_successes_horiztrans) {
     data_node_successes_horiztrans.New();
   }
@@ -591,17 +880,51 @@ emp::DataMonitor<int>& SymWorld::GetHorizontalTransmissionSuccessCount() {
 /**
  * Input: None
  *
- * Output: The DataMonitor<int>& that has the information representing
+ * Output: The EventCounter& that has the information representing
  * how many attempts were made to vertically transmit.
  *
  * Purpose: To retrieve the data nodes that is tracking the
  * number of attempted vertical transmissions.
  */
-emp::DataMonitor<int>& SymWorld::GetVerticalTransmissionAttemptCount() {
+EventCounter& SymWorld::GetVerticalTransmissionAttemptCount() {
   if (!data_node_attempts_verttrans) {
     data_node_attempts_verttrans.New();
   }
   return *data_node_attempts_verttrans;
 }
 
+
+/**
+ * Input: None
+ *
+ * Output: The EventCounter& that has the information representing
+ * how many host offspring were never made because they had nowhere to go.
+ *
+ * Purpose: To retrieve the counter of host births avoided by placing
+ * offspring before making them.
+ */
+EventCounter& SymWorld::GetAvoidedHostBirthCount() {
+  if (!data_node_avoided_host_births) {
+    data_node_avoided_host_births.New();
+  }
+  return *data_node_avoided_host_births;
+}
+
+
+/**
+ * Input: None
+ *
+ * Output: The EventCounter& that has the information representing
+ * how many symbiont offspring were never made because they had nowhere to go.
+ *
+ * Purpose: To retrieve the counter of symbiont births avoided by placing
+ * offspring before making them.
+ */
+EventCounter& SymWorld::GetAvoidedSymBirthCount() {
+  if (!data_node_avoided_sym_births) {
+    data_node_avoided_sym_births.New();
+  }
+  return *data_node_avoided_sym_births;
+}
+
 #endif
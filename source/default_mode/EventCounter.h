@@ -0,0 +1,209 @@
+#ifndef EVENT_COUNTER_H
+#define EVENT_COUNTER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/**
+  *
+  * Purpose: A cheap tally for events that happen many times per update, such as
+  * transmissions and lytic bursts. Each thread records into its own shard, so adding
+  * an event is two relaxed atomic adds to a cache line that usually no other thread
+  * writes; the shards are only summed when the counter is read (e.g. when a data
+  * file writes a row).
+  *
+*/
+class EventCounter {
+public:
+  /**
+    *
+    * Purpose: Represents the number of shards. Shards are handed out to threads in
+    * turn, so once more than this many threads have recorded events (counting ones
+    * that have exited) some share a shard. The adds are atomic, so a shared shard
+    * still counts every event; it is just no longer contention-free.
+    *
+  */
+  static constexpr size_t NUM_SHARDS = 64;
+
+private:
+  /**
+    *
+    * Purpose: Represents one thread's portion of the tally: how many events it has
+    * recorded and the summed value of those events. Padded to a cache line.
+    *
+  */
+  struct alignas(64) Shard {
+    std::atomic<size_t> count{0};
+    std::atomic<size_t> total{0};
+  };
+
+  /**
+    *
+    * Purpose: Represents the per-thread shards of the tally.
+    *
+  */
+  std::array<Shard, NUM_SHARDS> shards;
+
+  /**
+    *
+    * Purpose: Represents the count and total as of the last data file row that
+    * reported them, so each row can report the events since the previous one.
+    *
+  */
+  size_t reported_count = 0;
+  size_t reported_total = 0;
+
+  /**
+    *
+    * Purpose: Represents the number of events, and their summed value, between the
+    * last two calls to MarkReported, i.e. what the latest data file row reports.
+    *
+  */
+  size_t last_report_count = 0;
+  size_t last_report_total = 0;
+
+  /**
+   * Input: None
+   *
+   * Output: The index of the shard that the calling thread writes to.
+   *
+   * Purpose: To give every thread a stable shard for its lifetime.
+   */
+  static size_t GetShardID() {
+    static std::atomic<size_t> next_id{0};
+    thread_local size_t shard_id = next_id.fetch_add(1, std::memory_order_relaxed) % NUM_SHARDS;
+    return shard_id;
+  }
+
+public:
+  EventCounter() = default;
+  EventCounter(const EventCounter &) = delete;
+  EventCounter & operator=(const EventCounter &) = delete;
+
+  /**
+   * Input: The value carried by the event (defaults to 1, a plain tally).
+   *
+   * Output: None
+   *
+   * Purpose: To record one event in the calling thread's shard. Safe to call from
+   * any number of threads at once.
+   */
+  void AddDatum(size_t value = 1) {
+    Shard & shard = shards[GetShardID()];
+    shard.count.fetch_add(1, std::memory_order_relaxed);
+    shard.total.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The number of events recorded since the last reset.
+   *
+   * Purpose: To sum the event count across all shards.
+   */
+  size_t GetCount() const {
+    size_t sum = 0;
+    for (const Shard & shard : shards) sum += shard.count.load(std::memory_order_relaxed);
+    return sum;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The summed value of all events recorded since the last reset.
+   *
+   * Purpose: To sum the event values across all shards.
+   */
+  size_t GetTotal() const {
+    size_t sum = 0;
+    for (const Shard & shard : shards) sum += shard.total.load(std::memory_order_relaxed);
+    return sum;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The average value per event, NaN if no events were recorded.
+   *
+   * Purpose: To get the mean event value (e.g. the average burst size).
+   */
+  double GetMean() const {
+    return (double) GetTotal() / (double) GetCount();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The number of events, and their summed value, recorded since MarkReported() was last called.
+   *
+   * Purpose: To report the events since the previous data file row.
+   */
+  size_t GetUnreportedCount() const { return GetCount() - reported_count; }
+  size_t GetUnreportedTotal() const { return GetTotal() - reported_total; }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To note that everything recorded so far has been reported, closing
+   * off the events since the previous call for the row about to be written.
+   */
+  void MarkReported() {
+    size_t count = GetCount();
+    size_t total = GetTotal();
+    last_report_count = count - reported_count;
+    last_report_total = total - reported_total;
+    reported_count = count;
+    reported_total = total;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The number of events, and their summed value, that MarkReported last closed off.
+   *
+   * Purpose: To report the events since the previous data file row without changing the counter.
+   */
+  size_t GetLastReportCount() const { return last_report_count; }
+  size_t GetLastReportTotal() const { return last_report_total; }
+
+  size_t GetReportedCount() const { return reported_count; }
+  size_t GetReportedTotal() const { return reported_total; }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To clear all shards. Must only be called while no thread can call
+   * AddDatum (e.g. between updates, with no island threads running); the stores
+   * would otherwise drop events added alongside them.
+   */
+  void Reset() {
+    for (Shard & shard : shards) {
+      shard.count.store(0, std::memory_order_relaxed);
+      shard.total.store(0, std::memory_order_relaxed);
+    }
+    reported_count = reported_total = 0;
+    last_report_count = last_report_total = 0;
+  }
+
+  /**
+   * Input: The count and total to hold, and how much of them has been reported.
+   *
+   * Output: None
+   *
+   * Purpose: To restore a counter, e.g. from a checkpoint. Like Reset, must only
+   * be called while no thread can call AddDatum.
+   */
+  void Restore(size_t count, size_t total, size_t _reported_count, size_t _reported_total) {
+    Reset();
+    shards[0].count.store(count, std::memory_order_relaxed);
+    shards[0].total.store(total, std::memory_order_relaxed);
+    reported_count = _reported_count;
+    reported_total = _reported_total;
+  }
+};
+#endif
@@ -0,0 +1,383 @@
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+/**
+  *
+  * Purpose: Identifies an event log file and the version of its layout. The version
+  * must be bumped whenever what is written for an event (or its order) changes.
+  *
+*/
+constexpr uint64_t EVENT_LOG_MAGIC = 0x474f4c56454d5953; // "SYMEVLOG"
+constexpr uint32_t EVENT_LOG_VERSION = 1;
+
+/**
+  *
+  * Purpose: The kinds of event in an event log. Each event is written as its kind
+  * (one byte) followed by its fields; cells and updates are varints, interaction
+  * values are doubles written as they are laid out in memory. Infection chances
+  * seldom change from one symbiont to the next, so each is written as a varint of
+  * its bits XORed with the previous one's, which takes one byte when they match.
+  *
+  * UPDATE (update): the world is about to write the data rows of this update
+  * HOST_PLACED (cell, parent + 1 or 0, int_val, symbionts): a host was born or placed
+  * HOST_DIED (cell): a host died or left the world
+  * HOST_SYMBIONTS (cell, symbionts): a host's symbionts changed since it was last logged
+  * HOSTED_SYM_BORN (cell, parent + 1, int_val, infection_chance): a symbiont was born into the host in cell
+  * FREE_SYM_PLACED (cell, parent + 1 or 0, int_val, infection_chance): a free-living symbiont was born or placed
+  * FREE_SYM_DIED (cell): a free-living symbiont died or left the world
+  * FREE_SYM_MOVED (cell, destination): a free-living symbiont moved
+  * INFECTION (cell, whether it got in): the free-living symbiont in cell tried to enter the host there
+  * LYSIS_BURST (cell, burst size): the host in cell burst
+  * FINAL_ROW (update): the run stopped early and wrote a final data row
+  *
+  * Symbionts are written as their number followed by each one's int_val and
+  * infection_chance.
+  *
+*/
+enum class LogEvent : uint8_t {
+  UPDATE, HOST_PLACED, HOST_DIED, HOST_SYMBIONTS, HOSTED_SYM_BORN, FREE_SYM_PLACED,
+  FREE_SYM_DIED, FREE_SYM_MOVED, INFECTION, LYSIS_BURST, FINAL_ROW
+};
+
+/**
+  *
+  * Purpose: The traits of a symbiont as they are logged.
+  *
+*/
+struct LoggedSym {
+  double int_val = 0;
+  double infection_chance = 0;
+};
+
+/**
+  *
+  * Purpose: One event read back from an event log. cell holds the update for UPDATE
+  * and FINAL_ROW; other holds the parent (plus one, 0 for none), destination, burst
+  * size, or whether an infection got in, depending on the kind of event.
+  *
+*/
+struct LoggedEvent {
+  LogEvent kind = LogEvent::UPDATE;
+  size_t cell = 0;
+  size_t other = 0;
+  LoggedSym traits;
+  emp::vector<LoggedSym> syms;
+};
+
+/**
+  *
+  * Purpose: Appends events to an event log. Events are encoded into a buffer that is
+  * written to the file in large blocks, so logging costs little more than encoding.
+  *
+*/
+class EventLogWriter {
+private:
+  static constexpr size_t FLUSH_SIZE = 1 << 16;
+  static constexpr size_t NO_MOVE = (size_t) -1;
+
+  std::ofstream out;
+  std::string buffer;
+  size_t moving_from = NO_MOVE;
+  uint64_t last_infection_chance = 0;
+
+  void WriteByte(uint8_t value) { buffer.push_back((char) value); }
+
+  void WriteVarInt(uint64_t value) {
+    while (value >= 0x80) {
+      WriteByte((uint8_t) (value | 0x80));
+      value >>= 7;
+    }
+    WriteByte((uint8_t) value);
+  }
+
+  void WriteDouble(double value) {
+    char bytes[sizeof(double)];
+    std::memcpy(bytes, &value, sizeof(double));
+    buffer.append(bytes, sizeof(double));
+  }
+
+  template <typename T>
+  void WriteRaw(const T & value) {
+    buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  void StartEvent(LogEvent kind) {
+    if (buffer.size() >= FLUSH_SIZE) Flush();
+    WriteByte((uint8_t) kind);
+  }
+
+  template <typename ORG>
+  void WriteSym(ORG & sym) {
+    WriteDouble(sym.GetIntVal());
+    double infection_chance = sym.GetInfectionChance();
+    uint64_t bits;
+    std::memcpy(&bits, &infection_chance, sizeof(double));
+    WriteVarInt(bits ^ last_infection_chance);
+    last_infection_chance = bits;
+  }
+
+  template <typename ORG>
+  void WriteSyms(ORG & host) {
+    auto & syms = host.GetSymbionts();
+    WriteVarInt(syms.size());
+    for (auto sym : syms) WriteSym(*sym);
+  }
+
+public:
+  /**
+   * Input: The name of the log file, the world's seed, its number of cells, and the
+   * update it is at.
+   *
+   * Output: None
+   *
+   * Purpose: To start a new event log, replacing any file of that name.
+   */
+  EventLogWriter(const std::string & filename, int seed, size_t num_cells, size_t start_update)
+    : out(filename, std::ios::binary | std::ios::trunc) {
+    if (!out) throw "Could not open event log";
+    WriteRaw<uint64_t>(EVENT_LOG_MAGIC);
+    WriteRaw<uint32_t>(EVENT_LOG_VERSION);
+    WriteRaw<int64_t>(seed);
+    WriteRaw<uint64_t>(num_cells);
+    WriteRaw<uint64_t>(start_update);
+  }
+
+  ~EventLogWriter() { Flush(); }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To write the buffered events to the file.
+   */
+  void Flush() {
+    out.write(buffer.data(), buffer.size());
+    out.flush();
+    buffer.clear();
+  }
+
+  void Update(size_t update) {
+    StartEvent(LogEvent::UPDATE);
+    WriteVarInt(update);
+  }
+
+  void FinalRow(size_t update) {
+    StartEvent(LogEvent::FINAL_ROW);
+    WriteVarInt(update);
+  }
+
+  /**
+   * Input: The cell the host was placed in, its parent's cell (or -1 if it has
+   * none), and the host.
+   *
+   * Output: None
+   *
+   * Purpose: To log a host, with the symbionts it arrives with.
+   */
+  template <typename ORG>
+  void HostPlaced(size_t cell, int parent, ORG & host) {
+    StartEvent(LogEvent::HOST_PLACED);
+    WriteVarInt(cell);
+    WriteVarInt(parent + 1);
+    WriteDouble(host.GetIntVal());
+    WriteSyms(host);
+  }
+
+  void HostDied(size_t cell) {
+    StartEvent(LogEvent::HOST_DIED);
+    WriteVarInt(cell);
+  }
+
+  template <typename ORG>
+  void HostSymbionts(size_t cell, ORG & host) {
+    StartEvent(LogEvent::HOST_SYMBIONTS);
+    WriteVarInt(cell);
+    WriteSyms(host);
+  }
+
+  template <typename ORG>
+  void HostedSymBorn(size_t cell, size_t parent, ORG & sym) {
+    StartEvent(LogEvent::HOSTED_SYM_BORN);
+    WriteVarInt(cell);
+    WriteVarInt(parent + 1);
+    WriteSym(sym);
+  }
+
+  /**
+   * Input: The cell the free-living symbiont was placed in, its parent's cell (or -1
+   * if it has none), and the symbiont.
+   *
+   * Output: None
+   *
+   * Purpose: To log a free-living symbiont arriving in a cell. If it is the one a
+   * move was started for, the move is logged instead.
+   */
+  template <typename ORG>
+  void FreeSymPlaced(size_t cell, int parent, ORG & sym) {
+    if (moving_from != NO_MOVE) {
+      StartEvent(LogEvent::FREE_SYM_MOVED);
+      WriteVarInt(moving_from);
+      WriteVarInt(cell);
+      moving_from = NO_MOVE;
+      return;
+    }
+    StartEvent(LogEvent::FREE_SYM_PLACED);
+    WriteVarInt(cell);
+    WriteVarInt(parent + 1);
+    WriteSym(sym);
+  }
+
+  void FreeSymDied(size_t cell) {
+    StartEvent(LogEvent::FREE_SYM_DIED);
+    WriteVarInt(cell);
+  }
+
+  /**
+   * Input: The cell a free-living symbiont is leaving.
+   *
+   * Output: None
+   *
+   * Purpose: To mark the next free-living symbiont placed as one that moved from
+   * cell. If none is placed before EndMove, it died on the way.
+   */
+  void StartMove(size_t cell) { moving_from = cell; }
+
+  void EndMove() {
+    if (moving_from != NO_MOVE) FreeSymDied(moving_from);
+    moving_from = NO_MOVE;
+  }
+
+  void Infection(size_t cell, bool got_in) {
+    StartEvent(LogEvent::INFECTION);
+    WriteVarInt(cell);
+    WriteVarInt(got_in);
+  }
+
+  void LysisBurst(size_t cell, size_t burst_size) {
+    StartEvent(LogEvent::LYSIS_BURST);
+    WriteVarInt(cell);
+    WriteVarInt(burst_size);
+  }
+};
+
+/**
+  *
+  * Purpose: Reads back the events of an event log, in order. Throws if the file is
+  * not an event log of the current layout or ends in the middle of an event.
+  *
+*/
+class EventLogReader {
+private:
+  std::string data;
+  size_t pos = 0;
+  int seed;
+  size_t num_cells;
+  size_t start_update;
+  uint64_t last_infection_chance = 0;
+
+  uint8_t ReadByte() {
+    if (pos >= data.size()) throw "Event log is truncated";
+    return (uint8_t) data[pos++];
+  }
+
+  uint64_t ReadVarInt() {
+    uint64_t value = 0;
+    for (int shift = 0; ; shift += 7) {
+      uint8_t byte = ReadByte();
+      value |= (uint64_t) (byte & 0x7f) << shift;
+      if (!(byte & 0x80)) return value;
+      if (shift > 56) throw "Event log is corrupt";
+    }
+  }
+
+  template <typename T>
+  T ReadRaw() {
+    if (pos + sizeof(T) > data.size()) throw "Event log is truncated";
+    T value;
+    std::memcpy(&value, &data[pos], sizeof(T));
+    pos += sizeof(T);
+    return value;
+  }
+
+  LoggedSym ReadSym() {
+    LoggedSym sym;
+    sym.int_val = ReadRaw<double>();
+    last_infection_chance ^= ReadVarInt();
+    std::memcpy(&sym.infection_chance, &last_infection_chance, sizeof(double));
+    return sym;
+  }
+
+  void ReadSyms(emp::vector<LoggedSym> & syms) {
+    syms.resize(ReadVarInt());
+    for (LoggedSym & sym : syms) sym = ReadSym();
+  }
+
+public:
+  EventLogReader(const std::string & filename) {
+    std::ifstream in(filename, std::ios::binary | std::ios::ate);
+    if (!in) throw "Could not open event log";
+    data.resize(in.tellg());
+    in.seekg(0);
+    in.read(&data[0], data.size());
+    if (ReadRaw<uint64_t>() != EVENT_LOG_MAGIC) throw "Not an event log";
+    if (ReadRaw<uint32_t>() != EVENT_LOG_VERSION) throw "Event log was written by a different version";
+    seed = (int) ReadRaw<int64_t>();
+    num_cells = ReadRaw<uint64_t>();
+    start_update = ReadRaw<uint64_t>();
+  }
+
+  int GetSeed() const { return seed; }
+  size_t GetNumCells() const { return num_cells; }
+  size_t GetStartUpdate() const { return start_update; }
+
+  /**
+   * Input: Where to put the next event.
+   *
+   * Output: Whether there was another event.
+   *
+   * Purpose: To read the log one event at a time.
+   */
+  bool Next(LoggedEvent & event) {
+    if (pos >= data.size()) return false;
+    event.kind = (LogEvent) ReadByte();
+    event.cell = ReadVarInt();
+    event.other = 0;
+    event.syms.resize(0);
+    switch (event.kind) {
+      case LogEvent::UPDATE:
+      case LogEvent::FINAL_ROW:
+      case LogEvent::HOST_DIED:
+      case LogEvent::FREE_SYM_DIED:
+        break;
+      case LogEvent::HOST_PLACED:
+        event.other = ReadVarInt();
+        event.traits.int_val = ReadRaw<double>();
+        ReadSyms(event.syms);
+        break;
+      case LogEvent::HOST_SYMBIONTS:
+        ReadSyms(event.syms);
+        break;
+      case LogEvent::HOSTED_SYM_BORN:
+      case LogEvent::FREE_SYM_PLACED:
+        event.other = ReadVarInt();
+        event.traits = ReadSym();
+        break;
+      case LogEvent::FREE_SYM_MOVED:
+      case LogEvent::INFECTION:
+      case LogEvent::LYSIS_BURST:
+        event.other = ReadVarInt();
+        break;
+      default:
+        throw "Event log is corrupt";
+    }
+    return true;
+  }
+};
+#endif
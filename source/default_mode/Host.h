@@ -49,6 +49,14 @@ protected:
   */
   emp::vector<emp::Ptr<Organism>> repro_syms = {};
 
+  /**
+    *
+    * Purpose: Represents whether the host's symbionts have been added to or removed
+    * since the world last logged them (see EventLog).
+    *
+  */
+  bool syms_changed = false;
+
   /**
     *
     * Purpose: Represents the resource points possessed by a host.
@@ -206,6 +214,57 @@ public:
     return  "Host";
   }
 
+  /**
+   * Input: The writer of the checkpoint being saved.
+   *
+   * Output: None
+   *
+   * Purpose: To save the host's state, including its symbionts and reproductive
+   * symbionts (each preceded by its class name), to a checkpoint.
+   */
+  void WriteState(CheckpointWriter & writer) {
+    writer.Write(interaction_val);
+    writer.Write(age);
+    writer.Write(points);
+    writer.Write(res_in_process);
+    writer.Write(dead);
+    for (emp::vector<emp::Ptr<Organism>> * partners : {&syms, &repro_syms}) {
+      writer.Write<uint64_t>(partners->size());
+      for (emp::Ptr<Organism> sym : *partners) {
+        writer.WriteString(sym->GetName());
+        sym->WriteState(writer);
+      }
+    }
+  }
+
+  /**
+   * Input: The reader of the checkpoint being loaded.
+   *
+   * Output: None
+   *
+   * Purpose: To restore the host's state saved by WriteState, recreating its symbionts
+   * and reproductive symbionts through its world.
+   */
+  void ReadState(CheckpointReader & reader) {
+    interaction_val = reader.Read<double>();
+    age = reader.Read<int>();
+    points = reader.Read<double>();
+    res_in_process = reader.Read<double>();
+    dead = reader.Read<bool>();
+    for (emp::vector<emp::Ptr<Organism>> * partners : {&syms, &repro_syms}) {
+      for (emp::Ptr<Organism> sym : *partners) sym.Delete();
+      partners->resize(0);
+      size_t num_partners = reader.Read<uint64_t>();
+      for (size_t i = 0; i < num_partners; i++) {
+        emp::Ptr<Organism> sym = my_world->MakeCheckpointSym(reader.ReadString());
+        sym->ReadState(reader);
+        if (partners == &syms) sym->SetHost(this); //reproductive symbionts have no host yet
+        partners->push_back(sym);
+      }
+    }
+    syms_changed = true;
+  }
+
 /**
   * Input: None
   *
@@ -265,6 +324,16 @@ public:
  bool IsHost() { return true; }
 
 
+  /**
+   * Input: The random number generator the host should draw from
+   *
+   * Output: None
+   *
+   * Purpose: To move a host built with a temporary generator (e.g. by the bulk
+   * setup) over to the world's.
+   */
+  void SetRandom(emp::Ptr<emp::Random> _in) {random = _in;}
+
   /**
    * Input: A double representing the host's new interaction value.
    *
@@ -314,7 +383,10 @@ public:
    *
    * Purpose: To clear a host's symbionts.
    */
-  void ClearSyms() {syms.resize(0);}
+  void ClearSyms() {
+    syms.resize(0);
+    syms_changed = true;
+  }
 
 
   /**
@@ -327,6 +399,29 @@ public:
   void ClearReproSyms() {repro_syms.resize(0);}
 
 
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To take a host's dead symbionts out of its symbionts in one pass,
+   * keeping the order of the living ones, and leave them to be destroyed at the
+   * end of the update.
+   */
+  void RemoveDeadSymbionts() {
+    size_t num_alive = 0;
+    for (size_t j = 0; j < syms.size(); j++) {
+      if (syms[j]->GetDead()) my_world->Bury(syms[j]);
+      else syms[num_alive++] = syms[j];
+    }
+    if (num_alive < syms.size()) syms_changed = true;
+    syms.resize(num_alive);
+  }
+
+  bool GetSymbiontsChanged() {return syms_changed;}
+  void SetSymbiontsChanged(bool _in) {syms_changed = _in;}
+
+
   /**
    * Input: None
    *
@@ -436,11 +531,8 @@ public:
    * Purpose: To add a symbionts to a host's symbionts
    */
   int AddSymbiont(emp::Ptr<Organism> _in) {
-    if((int)syms.size() < my_config->SYM_LIMIT() && SymAllowedIn()){
-      syms.push_back(_in);
-      _in->SetHost(this);
-      _in->UponInjection();
-      return syms.size();
+    if(CanAddSymbiont()){
+      return AcceptSymbiont(_in);
     } else {
       _in.Delete();
       return 0;
@@ -448,6 +540,37 @@ public:
   }
 
 
+  /**
+   * Input: None
+   *
+   * Output: A bool representing whether a symbiont arriving now would be let in.
+   *
+   * Purpose: To decide whether a host has room for another symbiont (SYM_LIMIT) and
+   * lets it in (phage exclusion), before the symbiont is made. The exclusion draw is
+   * made here, so each arriving symbiont should be checked once.
+   */
+  bool CanAddSymbiont() {
+    return (int)syms.size() < my_config->SYM_LIMIT() && SymAllowedIn();
+  }
+
+
+  /**
+   * Input: The pointer to the organism that is to be added to the host's symbionts.
+   *
+   * Output: The int describing the symbiont's position ID.
+   *
+   * Purpose: To add a symbiont that CanAddSymbiont already let in.
+   */
+  int AcceptSymbiont(emp::Ptr<Organism> _in) {
+    if (my_world) my_world->NoteSymbiontAdded();
+    syms.push_back(_in);
+    syms_changed = true;
+    _in->SetHost(this);
+    _in->UponInjection();
+    return syms.size();
+  }
+
+
   /**
    * Input: None
    *
@@ -640,30 +763,55 @@ public:
    *
    * Output: None
    *
-   * Purpose: To process the host, meaning determining eligibility for reproduction, checking for vertical
-   * transmission, removing dead syms, and processing alive syms.
+   * Purpose: To reproduce the host if it has enough points and somewhere to put
+   * its offspring, checking for vertical transmission of its symbionts. Unless the
+   * world has a custom birth function, the offspring is placed before it is made.
    */
-  void Process(emp::WorldPosition pos) {
-    size_t location = pos.GetIndex();
-    //Currently just wrapping to use the existing function
-    double desired_resources = my_config->RES_DISTRIBUTE();
-    double world_resources = my_world->PullResources(desired_resources); //recieve resources from the world
-    double resources = HandleEctosymbiosis(world_resources, location);
-    if(resources > 0) DistribResources(resources); //if there are enough resources left, distribute them.
-
-    // Check reproduction
+  void CheckReproduction(size_t location) {
     if (GetPoints() >= my_config->HOST_REPRO_RES() && repro_syms.size() == 0) {  // if host has more points than required for repro
+        my_world->TriggerBeforeRepro(location);
+        //the offspring is only made if it has somewhere to go; a custom birth
+        //function places it once it is made instead
+        emp::WorldPosition birth_pos;
+        if (!my_world->HasCustomBirthPos()) {
+          birth_pos = my_world->FindBirthPos(location);
+          if (!birth_pos.IsValid()) {
+            SetPoints(0);
+            my_world->GetAvoidedHostBirthCount().AddDatum(1);
+            return;
+          }
+        }
         // will replicate & mutate a random offset from parent values
         // while resetting resource points for host and symbiont to zero
-       emp::Ptr<Organism> host_baby = Reproduce();
+        emp::Ptr<Organism> host_baby = Reproduce();
 
         //Now check if symbionts get to vertically transmit
         for(size_t j = 0; j< (GetSymbionts()).size(); j++){
           emp::Ptr<Organism> parent = GetSymbionts()[j];
           parent->VerticalTransmission(host_baby);
         }
-        my_world->DoBirth(host_baby, location); //Automatically deals with grid
+        my_world->PlaceBirth(host_baby, birth_pos, location);
       }
+  }
+
+
+  /**
+   * Input: The size_t value representing the location of the host.
+   *
+   * Output: None
+   *
+   * Purpose: To process the host, meaning determining eligibility for reproduction, checking for vertical
+   * transmission, removing dead syms, and processing alive syms.
+   */
+  void Process(emp::WorldPosition pos) {
+    size_t location = pos.GetIndex();
+    //Currently just wrapping to use the existing function
+    double desired_resources = my_config->RES_DISTRIBUTE();
+    double world_resources = my_world->PullResources(desired_resources); //recieve resources from the world
+    double resources = HandleEctosymbiosis(world_resources, location);
+    if(resources > 0) DistribResources(resources); //if there are enough resources left, distribute them.
+
+    CheckReproduction(location);
     if (GetDead()){
         return; //If host is dead, return
       }
@@ -680,13 +828,42 @@ public:
           if(!curSym->GetDead()){
             curSym->Process(sym_pos);
           }
-          if(curSym->GetDead()){
-            syms.erase(syms.begin() + j); //if the symbiont dies during their process, remove from syms list
-            curSym.Delete();
-          }
         } //for each sym in syms
+        RemoveDeadSymbionts();
       } //if org has syms
     GrowOlder();
   }
+
+
+  /**
+   * Input: The size_t value representing the location of the host.
+   *
+   * Output: None
+   *
+   * Purpose: To process the host while the world has no symbionts at all, doing
+   * only what Process would do for a host without partners: take in and use
+   * resources, maybe reproduce, and age.
+   */
+  void ProcessWithoutSymbionts(emp::WorldPosition pos) {
+    size_t location = pos.GetIndex();
+    double resources = my_world->PullResources(my_config->RES_DISTRIBUTE());
+    if(resources > 0) DistribResources(resources);
+    CheckReproduction(location);
+    if (GetDead()) return;
+    GrowOlder();
+  }
 };//Host
+
+/**
+ * Input: The class name of a host saved in a checkpoint.
+ *
+ * Output: A new host of that class, whose state is then read from the checkpoint.
+ *
+ * Purpose: To recreate hosts when loading a checkpoint.
+ */
+emp::Ptr<Organism> SymWorld::MakeCheckpointHost(const std::string & name) {
+  if (name == "Host") return emp::NewPtr<Host>(&GetRandom(), this, my_config);
+  throw "Checkpoint contains a host this world cannot make";
+}
+
 #endif
@@ -0,0 +1,68 @@
+#ifndef HOSTED_SYM_TABLE_H
+#define HOSTED_SYM_TABLE_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../Organism.h"
+
+/**
+  *
+  * Purpose: All of a world's hosted symbionts in one contiguous table, grouped by
+  * host cell in compressed sparse row form: the symbionts of the host in cell i are
+  * rows Begin(i) to End(i). Interaction value and infection chance are copied into
+  * columns of their own so that the data nodes that bin them stream through plain
+  * arrays instead of following host and symbiont pointers and making virtual calls.
+  * Hosts still own their symbionts; the table is a snapshot, stamped with the update
+  * it was built at, and SymWorld::UseHostedSymTable rebuilds it for any other update.
+  *
+*/
+class HostedSymTable {
+private:
+  emp::vector<size_t> offsets = {0};
+  emp::vector<emp::Ptr<Organism>> syms;
+  emp::vector<double> int_vals;
+  emp::vector<double> infection_chances;
+  size_t built_at = (size_t) -1;
+
+public:
+  /**
+   * Input: The world's host population and the update it is at.
+   *
+   * Output: None
+   *
+   * Purpose: To refill the table from the hosts' symbionts, in cell order and in
+   * each host's symbiont order. Capacity is kept between builds, so once the
+   * population has grown this allocates nothing.
+   */
+  void Build(const emp::vector<emp::Ptr<Organism>> & pop, size_t update) {
+    built_at = update;
+    offsets.resize(pop.size() + 1);
+    syms.clear();
+    int_vals.clear();
+    infection_chances.clear();
+    offsets[0] = 0;
+    for (size_t i = 0; i < pop.size(); i++) {
+      if (pop[i]) {
+        for (emp::Ptr<Organism> sym : pop[i]->GetSymbionts()) {
+          syms.push_back(sym);
+          int_vals.push_back(sym->GetIntVal());
+          infection_chances.push_back(sym->GetInfectionChance());
+        }
+      }
+      offsets[i + 1] = syms.size();
+    }
+  }
+
+  bool IsBuiltAt(size_t update) const { return built_at == update; }
+  size_t GetNumCells() const { return offsets.size() - 1; }
+  size_t GetNumSyms() const { return syms.size(); }
+
+  size_t Begin(size_t cell) const { return offsets[cell]; }
+  size_t End(size_t cell) const { return offsets[cell + 1]; }
+  size_t GetCount(size_t cell) const { return offsets[cell + 1] - offsets[cell]; }
+
+  emp::Ptr<Organism> GetSym(size_t row) const { return syms[row]; }
+  double GetIntVal(size_t row) const { return int_vals[row]; }
+  double GetInfectionChance(size_t row) const { return infection_chances[row]; }
+};
+#endif
@@ -0,0 +1,78 @@
+#ifndef ISLANDS_H
+#define ISLANDS_H
+
+#include "SymWorld.h"
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <string>
+#include <thread>
+
+/**
+ * Input: The number of islands and the function to run on each (given its number).
+ *
+ * Output: None
+ *
+ * Purpose: To run something on every island at once, each island on one thread at a
+ * time (up to one thread per core). Islands share nothing while it runs, so what
+ * each island does does not depend on how many threads there are. Whatever is
+ * thrown on any island (the first island's, if several throw) is rethrown once
+ * every thread is done.
+ *
+ * Debug builds (EMP_TRACK_MEM) run every island on this thread instead: emp::Ptr's
+ * pointer tracker is shared by all threads and is not thread-safe.
+ */
+template <typename ISLAND_FUN>
+void ForEachIsland(size_t num_islands, ISLAND_FUN island_fun) {
+  std::atomic<size_t> next{0};
+  emp::vector<std::exception_ptr> errors(num_islands);
+  auto worker = [&](){
+    for (size_t i = next++; i < num_islands; i = next++) {
+      try {
+        island_fun(i);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    }
+  };
+  size_t num_threads = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), num_islands));
+#ifdef EMP_TRACK_MEM
+  num_threads = 1;
+#endif
+  emp::vector<std::thread> threads;
+  for (size_t t = 1; t < num_threads; t++) threads.emplace_back(worker);
+  worker();
+  for (std::thread & thread : threads) thread.join();
+  for (std::exception_ptr error : errors) if (error) std::rethrow_exception(error);
+}
+
+/**
+ * Input: The islands' worlds and the chance each host and free-living symbiont has of
+ * leaving its island.
+ *
+ * Output: The number of organisms that moved.
+ *
+ * Purpose: To move migrants between islands. Every island first writes its emigrants
+ * into its own row of outboxes (one per destination); once all are written, every
+ * island reads the outboxes addressed to it, in island order. Each outbox has one
+ * writer and, after the writers are done, one reader, so no locks are needed, and
+ * each island draws only from its own random number generator, so migration is the
+ * same however the islands are spread over threads.
+ */
+template <typename WORLD_T>
+size_t MigrateBetweenIslands(const emp::vector<emp::Ptr<WORLD_T>> & islands, double rate) {
+  size_t num_islands = islands.size();
+  emp::vector<emp::vector<std::string>> outboxes(num_islands, emp::vector<std::string>(num_islands));
+  emp::vector<size_t> num_emigrants(num_islands, 0);
+  ForEachIsland(num_islands, [&](size_t i){
+    num_emigrants[i] = islands[i]->Emigrate(i, num_islands, rate, outboxes[i]);
+  });
+  ForEachIsland(num_islands, [&](size_t i){
+    for (size_t from = 0; from < num_islands; from++) islands[i]->Immigrate(outboxes[from][i]);
+  });
+  size_t total = 0;
+  for (size_t count : num_emigrants) total += count;
+  return total;
+}
+#endif
@@ -0,0 +1,108 @@
+#ifndef JOINT_HISTOGRAM_H
+#define JOINT_HISTOGRAM_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../Organism.h"
+#include <algorithm>
+#include <functional>
+#include <ostream>
+#include <string>
+
+/**
+  *
+  * Purpose: Represents a symbiont trait that can be binned: a name, how to read
+  * it from an organism, and the range its values fall in.
+  *
+*/
+struct SymTrait {
+  std::string name;
+  std::function<double(Organism &)> fun;
+  double min;
+  double max;
+};
+
+/**
+  *
+  * Purpose: A 2D histogram of a pair of symbiont traits, e.g. interaction value
+  * against efficiency. Values outside a trait's range are counted in the nearest bin.
+  *
+*/
+class JointHistogram {
+private:
+  SymTrait x_trait;
+  SymTrait y_trait;
+  size_t x_bins;
+  size_t y_bins;
+  emp::vector<size_t> counts; //row-major, indexed by bin_x * y_bins + bin_y
+
+  /**
+   * Input: The value, the trait it belongs to, and the number of bins for that trait.
+   *
+   * Output: The bin the value falls in.
+   *
+   * Purpose: To bin one trait value.
+   */
+  static size_t GetBin(double value, const SymTrait & trait, size_t num_bins) {
+    double prog = (value - trait.min) / (trait.max - trait.min) * num_bins;
+    if (prog < 0) return 0;
+    size_t bin = (size_t) prog;
+    return bin >= num_bins ? num_bins - 1 : bin;
+  }
+
+public:
+  JointHistogram(const SymTrait & _x_trait, const SymTrait & _y_trait, size_t _x_bins, size_t _y_bins)
+    : x_trait(_x_trait), y_trait(_y_trait), x_bins(_x_bins), y_bins(_y_bins), counts(_x_bins * _y_bins, 0) {}
+
+  const SymTrait & GetXTrait() const { return x_trait; }
+  const SymTrait & GetYTrait() const { return y_trait; }
+  size_t GetXBins() const { return x_bins; }
+  size_t GetYBins() const { return y_bins; }
+
+  /**
+   * Input: The x and y bins.
+   *
+   * Output: The number of organisms counted in that cell of the histogram.
+   *
+   * Purpose: To read one cell of the histogram.
+   */
+  size_t GetCount(size_t bin_x, size_t bin_y) const { return counts[bin_x * y_bins + bin_y]; }
+
+  /**
+   * Input: The organism to count.
+   *
+   * Output: None
+   *
+   * Purpose: To bin an organism by both of its traits.
+   */
+  void AddOrg(Organism & org) {
+    counts[GetBin(x_trait.fun(org), x_trait, x_bins) * y_bins + GetBin(y_trait.fun(org), y_trait, y_bins)]++;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To clear all counts.
+   */
+  void Reset() { std::fill(counts.begin(), counts.end(), 0); }
+
+  /**
+   * Input: The stream to write to and the current update.
+   *
+   * Output: None
+   *
+   * Purpose: To write one "update,x_trait,y_trait,bin_x,bin_y,count" row for every
+   * non-empty cell of the histogram.
+   */
+  void WriteSparse(std::ostream & os, size_t update) const {
+    for (size_t bin_x = 0; bin_x < x_bins; bin_x++) {
+      for (size_t bin_y = 0; bin_y < y_bins; bin_y++) {
+        size_t count = counts[bin_x * y_bins + bin_y];
+        if (count == 0) continue;
+        os << update << ',' << x_trait.name << ',' << y_trait.name << ',' << bin_x << ',' << bin_y << ',' << count << '\n';
+      }
+    }
+  }
+};
+#endif
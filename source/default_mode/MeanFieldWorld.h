@@ -0,0 +1,646 @@
+#ifndef MEAN_FIELD_WORLD_H
+#define MEAN_FIELD_WORLD_H
+
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../../Empirical/include/emp/data/DataFile.hpp"
+#include "../ConfigSetup.h"
+#include "TraitBins.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+/**
+  *
+  * Purpose: Expected counts below this are dropped, so the solver only works on the
+  * part of the trait space where there are organisms (mutation would otherwise
+  * spread vanishing amounts of them over every class).
+  *
+*/
+constexpr double MEAN_FIELD_NEGLIGIBLE = 1e-9;
+
+/**
+  *
+  * Purpose: A mutation kernel as a fixed convolution: away from the ends of the
+  * trait range every bin moves the same shares the same number of bins, so those
+  * bins are mutated together, one weighted copy of the whole run per offset.
+  * Only the bins near the ends (edge_bins) use their own moves from the kernel.
+  *
+*/
+struct MutationStencil {
+  size_t reach = 0;               // the largest move, in bins; weights[reach] is staying put
+  emp::vector<double> weights;    // weights[reach + d] is the share moving d bins
+  size_t first_interior = 1;      // the bins from first_interior to last_interior use the weights
+  size_t last_interior = 0;
+  emp::vector<size_t> edge_bins;  // the rest
+  TraitKernel kernel;
+};
+
+/**
+ * Input: The mutation kernel.
+ *
+ * Output: Its stencil.
+ *
+ * Purpose: To find the weights the kernel moves interior bins by (those of its
+ * middle bin), and which bins move by exactly those.
+ */
+MutationStencil MakeMutationStencil(const TraitKernel & kernel) {
+  MutationStencil stencil;
+  stencil.kernel = kernel;
+  size_t num_bins = kernel.size();
+  size_t middle = num_bins / 2;
+  for (const auto & move : kernel[middle]) {
+    stencil.reach = std::max(stencil.reach, move.first > middle ? move.first - middle : middle - move.first);
+  }
+  stencil.weights.assign(2 * stencil.reach + 1, 0);
+  for (const auto & move : kernel[middle]) stencil.weights[stencil.reach + move.first - middle] = move.second;
+
+  size_t num_weights = 0;
+  for (double weight : stencil.weights) num_weights += weight != 0;
+  emp::vector<bool> interior(num_bins, false);
+  for (size_t bin = stencil.reach; bin + stencil.reach < num_bins; bin++) {
+    size_t num_moves = 0;
+    bool same = true;
+    for (const auto & move : kernel[bin]) {
+      if (move.second == 0) continue;
+      size_t offset = stencil.reach + move.first - bin;
+      if (move.first + stencil.reach < bin || offset >= stencil.weights.size() || std::abs(move.second - stencil.weights[offset]) > 1e-15) same = false;
+      num_moves++;
+    }
+    interior[bin] = same && num_moves == num_weights;
+  }
+  // the interior is one run of bins around the middle
+  stencil.first_interior = middle;
+  stencil.last_interior = middle;
+  while (stencil.first_interior > 0 && interior[stencil.first_interior - 1]) stencil.first_interior--;
+  while (stencil.last_interior + 1 < num_bins && interior[stencil.last_interior + 1]) stencil.last_interior++;
+  if (!interior[middle]) {
+    stencil.first_interior = 1;
+    stencil.last_interior = 0;
+  }
+  for (size_t bin = 0; bin < num_bins; bin++) {
+    if (bin < stencil.first_interior || bin > stencil.last_interior) stencil.edge_bins.push_back(bin);
+  }
+  return stencil;
+}
+
+/**
+  *
+  * Purpose: A deterministic solver for the default mode in a well-mixed world
+  * (GRID 0). It follows the expected number of hosts in each class (interaction value
+  * bin, symbionts' bin and number of symbionts, as in TauLeapWorld) instead of
+  * drawing events, so each run gives the expected trajectory of the tau-leaping
+  * engine in one pass, and its cost depends only on the number of bins.
+  *
+  * Rates are those of TauLeapWorld, from the same resource split and mutation kernel.
+  * Mutation between coarse bins keeps the step's variance, and a symbiont joining a
+  * host moves the host's symbionts to the two bins around their mean, so the mean
+  * is kept too. Counts are fractional and extinction is never reached exactly.
+  *
+  * Everything that does not depend on the counts (each class's birth and horizontal
+  * transmission rates, the vertical transmission shares, the bins merged symbionts
+  * go to, and the mutation stencils) is worked out once, from the configuration the
+  * world is made with, and each update reuses the same buffers.
+  *
+*/
+class MeanFieldWorld {
+private:
+  emp::Ptr<SymConfigBase> my_config;
+  size_t num_bins;
+  size_t sym_limit;
+  double num_cells;
+  size_t update = 0;
+
+  emp::vector<double> traits;
+  emp::vector<size_t> hist_bins;
+
+  /**
+    *
+    * Purpose: uninfected[h] is the expected number of hosts in bin h without
+    * symbionts, and infected[InfectedIndex(h, s, k)] the number in bin h with k
+    * symbionts in bin s.
+    *
+  */
+  emp::vector<double> uninfected;
+  emp::vector<double> infected;
+
+  emp::vector<emp::vector<double>> host_pair_gain;
+  emp::vector<emp::vector<double>> sym_pair_gain;
+
+  /**
+    *
+    * Purpose: Represents the per-class rates of Step: the expected number of placed
+    * offspring per uninfected host in bin h (uninfected_births[h]) and per host in
+    * bin h with symbionts in bin s (infected_births[h * num_bins + s]), the expected
+    * horizontal offspring per symbiont of each infected class (horiz_births, indexed
+    * like infected), and vert_count_shares[k][j], the share of offspring of a host
+    * with k symbionts that inherit j of them.
+    *
+  */
+  emp::vector<double> uninfected_births;
+  emp::vector<double> infected_births;
+  emp::vector<double> horiz_births;
+  emp::vector<emp::vector<double>> vert_count_shares;
+
+  /**
+    *
+    * Purpose: Represents where a horizontally transmitted symbiont in bin a joining
+    * k symbionts in bin s leaves them: the lower of the two bins around their new
+    * mean, at merge_lower[((k - 1) * num_bins + s) * num_bins + a], and the share
+    * that goes to the bin above it, at the same index of merge_upper_share. The bins
+    * they can end up in for any arrival are merge_first to merge_last, indexed by
+    * (k - 1) * num_bins + s.
+    *
+  */
+  emp::vector<size_t> merge_lower;
+  emp::vector<double> merge_upper_share;
+  emp::vector<size_t> merge_first;
+  emp::vector<size_t> merge_last;
+
+  MutationStencil host_stencil;
+  MutationStencil sym_stencil;
+
+  // buffers Step fills each update
+  emp::vector<double> born_uninfected;
+  emp::vector<double> born_infected;
+  emp::vector<double> horiz_offspring;
+  emp::vector<double> arrival_shares;
+  emp::vector<double> merged_shares; // indexed like merge_lower, by merged bin instead of arrival
+  emp::vector<double> newly_infected;
+  emp::vector<double> mutated;
+
+  emp::vector<emp::Ptr<emp::DataFile>> files;
+
+  size_t InfectedIndex(size_t h, size_t s, size_t k) const { return (h * num_bins + s) * sym_limit + k - 1; }
+
+public:
+  /**
+   * Input: The configuration.
+   *
+   * Output: None
+   *
+   * Purpose: To set up an empty world. Throws if the configuration uses something
+   * the solver does not model.
+   */
+  MeanFieldWorld(emp::Ptr<SymConfigBase> _config) : my_config(_config) {
+    if (my_config->GRID()) throw "MEAN_FIELD needs a well-mixed world (GRID 0)";
+    if (my_config->FREE_LIVING_SYMS()) throw "MEAN_FIELD does not model free-living symbionts";
+    if (my_config->LIMITED_RES_TOTAL() != -1) throw "MEAN_FIELD does not model limited resources";
+    if (my_config->HOST_AGE_MAX() > 0 || my_config->SYM_AGE_MAX() > 0) throw "MEAN_FIELD does not model aging";
+    if (my_config->PHYLOGENY()) throw "MEAN_FIELD does not track phylogenies";
+    if (my_config->MEAN_FIELD_BINS() < 2) throw "MEAN_FIELD_BINS must be at least 2";
+
+    num_bins = my_config->MEAN_FIELD_BINS();
+    sym_limit = std::max(my_config->SYM_LIMIT(), 0);
+    num_cells = my_config->GRID_X() * my_config->GRID_Y();
+    traits = MakeTraits(num_bins);
+    hist_bins.resize(num_bins);
+    for (size_t i = 0; i < num_bins; i++) hist_bins[i] = GetHistBin(traits[i]);
+    uninfected.assign(num_bins, 0);
+    infected.assign(num_bins * num_bins * sym_limit, 0);
+    MakePairGains(traits, *my_config, host_pair_gain, sym_pair_gain);
+    SetKernels();
+    SetRates();
+  }
+
+  ~MeanFieldWorld() {
+    for (emp::Ptr<emp::DataFile> file : files) file.Delete();
+  }
+
+  MeanFieldWorld(const MeanFieldWorld &) = delete;
+  MeanFieldWorld & operator=(const MeanFieldWorld &) = delete;
+
+  size_t GetUpdate() const { return update; }
+  size_t GetNumBins() const { return num_bins; }
+  double GetTrait(size_t bin) const { return traits[bin]; }
+
+  /**
+   * Input: The expected number of hosts, their interaction value, and the number and
+   * interaction value of each one's symbionts.
+   *
+   * Output: None
+   *
+   * Purpose: To add hosts to the world, split between the two bins around each
+   * interaction value so their mean is exact.
+   */
+  void AddHosts(double count, double host_int, size_t num_syms = 0, double sym_int = 0) {
+    num_syms = std::min(num_syms, sym_limit);
+    ForEachSplitBin(host_int, [&](size_t h, double host_share){
+      if (num_syms == 0) {
+        uninfected[h] += count * host_share;
+        return;
+      }
+      ForEachSplitBin(sym_int, [&](size_t s, double sym_share){
+        infected[InfectedIndex(h, s, num_syms)] += count * host_share * sym_share;
+      });
+    });
+  }
+
+  double GetNumUninfectedHosts() const {
+    double total = 0;
+    for (double count : uninfected) total += count;
+    return total;
+  }
+
+  double GetNumHosts() const {
+    double total = GetNumUninfectedHosts();
+    for (double count : infected) total += count;
+    return total;
+  }
+
+  double GetNumSyms() const {
+    double total = 0;
+    for (size_t i = 0; i < infected.size(); i++) total += infected[i] * (i % sym_limit + 1);
+    return total;
+  }
+
+  double GetMeanHostIntVal() const {
+    double total = 0;
+    for (size_t h = 0; h < num_bins; h++) total += uninfected[h] * traits[h];
+    for (size_t i = 0; i < infected.size(); i++) total += infected[i] * traits[i / sym_limit / num_bins];
+    return total / GetNumHosts();
+  }
+
+  double GetMeanSymIntVal() const {
+    double total = 0;
+    for (size_t i = 0; i < infected.size(); i++) total += infected[i] * (i % sym_limit + 1) * traits[i / sym_limit % num_bins];
+    return total / GetNumSyms();
+  }
+
+  /**
+   * Input: The index of a data file histogram bin (0 for -1 to <-0.9, ..., 19 for 0.9 to <1).
+   *
+   * Output: The expected number of hosts (or symbionts) whose interaction value falls in it.
+   *
+   * Purpose: To fill in the data files' histograms.
+   */
+  double GetHostHistCount(size_t hist_bin) const {
+    double total = 0;
+    for (size_t h = 0; h < num_bins; h++) if (hist_bins[h] == hist_bin) total += uninfected[h];
+    for (size_t i = 0; i < infected.size(); i++) {
+      if (hist_bins[i / sym_limit / num_bins] == hist_bin) total += infected[i];
+    }
+    return total;
+  }
+
+  double GetSymHistCount(size_t hist_bin) const {
+    double total = 0;
+    for (size_t i = 0; i < infected.size(); i++) {
+      if (hist_bins[i / sym_limit % num_bins] == hist_bin) total += infected[i] * (i % sym_limit + 1);
+    }
+    return total;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To set up the mutation kernels from the MUTATION settings.
+   */
+  void SetKernels() {
+    double host_size = my_config->HOST_MUTATION_SIZE();
+    if (host_size == -1) host_size = my_config->MUTATION_SIZE();
+    double host_rate = my_config->HOST_MUTATION_RATE();
+    if (host_rate == -1) host_rate = my_config->MUTATION_RATE();
+    host_stencil = MakeMutationStencil(MakeTraitKernel(traits, host_rate, host_size));
+    sym_stencil = MakeMutationStencil(MakeTraitKernel(traits, my_config->MUTATION_RATE(), my_config->MUTATION_SIZE()));
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To work out the per-class rates and shares Step uses, as in
+   * TauLeapWorld::Leap, and the bins merged symbionts go to.
+   */
+  void SetRates() {
+    double repro_res = my_config->HOST_REPRO_RES();
+    double horiz_res = my_config->SYM_HORIZ_TRANS_RES();
+    double vert_res = my_config->SYM_VERT_TRANS_RES();
+    double resources = my_config->RES_DISTRIBUTE();
+
+    double vert_ready = 1;
+    if (vert_res > 0 && my_config->HORIZ_TRANS() && horiz_res > 0) vert_ready = std::max(0.0, 1 - vert_res / horiz_res);
+    double vert_chance = my_config->VERTICAL_TRANSMISSION() * vert_ready;
+    vert_count_shares.assign(sym_limit + 1, {});
+    for (size_t k = 0; k <= sym_limit; k++) {
+      for (size_t j = 0; j <= k; j++) {
+        vert_count_shares[k].push_back(std::exp(std::lgamma(k + 1.0) - std::lgamma(j + 1.0) - std::lgamma(k - j + 1.0))
+          * std::pow(vert_chance, j) * std::pow(1 - vert_chance, k - j));
+      }
+    }
+    auto birth_rate = [repro_res](double gain){ return repro_res > 0 ? std::min(1.0, gain / repro_res) : 1; };
+    double placed_chance = num_cells > 1 ? 1 - 1.0 / num_cells : 0;
+
+    uninfected_births.resize(num_bins);
+    infected_births.resize(num_bins * num_bins);
+    horiz_births.assign(infected.size(), 0);
+    for (size_t h = 0; h < num_bins; h++) {
+      uninfected_births[h] = birth_rate(resources * (1 - std::abs(traits[h]))) * placed_chance;
+      for (size_t s = 0; s < num_bins; s++) {
+        double host_rate = birth_rate(host_pair_gain[h][s]);
+        infected_births[h * num_bins + s] = host_rate * placed_chance;
+        if (!my_config->HORIZ_TRANS()) continue;
+        for (size_t k = 1; k <= sym_limit; k++) {
+          double sym_gain = std::max(0.0, sym_pair_gain[h][s] / k - vert_res * vert_chance * host_rate);
+          horiz_births[InfectedIndex(h, s, k)] = horiz_res > 0 ? std::min(1.0, sym_gain / horiz_res) : 1;
+        }
+      }
+    }
+
+    size_t num_merges = sym_limit > 1 ? (sym_limit - 1) * num_bins * num_bins : 0;
+    merge_lower.assign(num_merges, 0);
+    merge_upper_share.assign(num_merges, 0);
+    merge_first.assign(num_merges / std::max<size_t>(num_bins, 1), num_bins);
+    merge_last.assign(num_merges / std::max<size_t>(num_bins, 1), 0);
+    for (size_t k = 1; k < sym_limit; k++) {
+      for (size_t s = 0; s < num_bins; s++) {
+        size_t range = (k - 1) * num_bins + s;
+        for (size_t a = 0; a < num_bins; a++) {
+          size_t i = ((k - 1) * num_bins + s) * num_bins + a;
+          size_t lower = num_bins;
+          ForEachSplitBin((k * traits[s] + traits[a]) / (k + 1), [&](size_t bin, double share){
+            if (lower == num_bins) lower = bin;
+            else merge_upper_share[i] = share;
+          });
+          merge_lower[i] = lower;
+          merge_first[range] = std::min(merge_first[range], lower);
+          merge_last[range] = std::max(merge_last[range], merge_upper_share[i] > 0 ? lower + 1 : lower);
+        }
+      }
+    }
+
+    born_uninfected.assign(num_bins, 0);
+    born_infected.assign(infected.size(), 0);
+    horiz_offspring.assign(num_bins, 0);
+    arrival_shares.assign(num_bins, 0);
+    merged_shares.assign(num_merges, 0);
+    newly_infected.assign(infected.size(), 0);
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To turn mutation off for the no-mutation updates.
+   */
+  void SetMutationZero() {
+    host_stencil = MakeMutationStencil(MakeTraitKernel(traits, 0, 0));
+    sym_stencil = MakeMutationStencil(MakeTraitKernel(traits, 0, 0));
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To build the expected starting population of worldSetup: POP_SIZE hosts
+   * with HOST_INT (or spread evenly, or the competition mode's two values), with the
+   * POP_SIZE * START_MOI symbionts that land in them spread as a Poisson distribution.
+   */
+  void Setup() {
+    double pop_size = my_config->POP_SIZE() == -1 ? num_cells : std::min<double>(my_config->POP_SIZE(), num_cells);
+    emp::vector<double> host_shares(num_bins, 0);
+    if (my_config->HOST_INT() == -2 && !my_config->COMPETITION_MODE()) {
+      for (size_t h = 0; h < num_bins; h++) host_shares[h] = ((h == 0 || h == num_bins - 1) ? 0.5 : 1) / (num_bins - 1);
+    } else if (my_config->COMPETITION_MODE()) {
+      ForEachSplitBin(0, [&](size_t h, double share){ host_shares[h] += share / 2; });
+      ForEachSplitBin(0.95, [&](size_t h, double share){ host_shares[h] += share / 2; });
+    } else {
+      ForEachSplitBin(my_config->HOST_INT(), [&](size_t h, double share){ host_shares[h] += share; });
+    }
+    emp::vector<double> sym_shares(num_bins, 0);
+    if (my_config->SYM_INT() == -2) {
+      for (size_t s = 0; s < num_bins; s++) sym_shares[s] = ((s == 0 || s == num_bins - 1) ? 0.5 : 1) / (num_bins - 1);
+    } else {
+      ForEachSplitBin(my_config->SYM_INT(), [&](size_t s, double share){ sym_shares[s] += share; });
+    }
+
+    double mean_landed = pop_size > 0 ? pop_size * my_config->START_MOI() / num_cells : 0;
+    emp::vector<double> sym_count_shares(sym_limit + 1, 0);
+    double poisson = std::exp(-mean_landed);
+    double tail = 1;
+    for (size_t k = 0; k < sym_limit; k++) {
+      sym_count_shares[k] = poisson;
+      tail -= poisson;
+      poisson *= mean_landed / (k + 1);
+    }
+    sym_count_shares[sym_limit] = std::max(0.0, tail);
+
+    for (size_t h = 0; h < num_bins; h++) {
+      if (host_shares[h] == 0) continue;
+      uninfected[h] += pop_size * host_shares[h] * sym_count_shares[0];
+      for (size_t k = 1; k <= sym_limit; k++) {
+        for (size_t s = 0; s < num_bins; s++) {
+          infected[InfectedIndex(h, s, k)] += pop_size * host_shares[h] * sym_count_shares[k] * sym_shares[s];
+        }
+      }
+    }
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To set up the HostVals and SymVals data files, with the same columns
+   * as the individual-based engine's (counts are expected counts, so not whole).
+   */
+  void CreateDataFiles() {
+    std::string file_ending = "_SEED"+std::to_string(my_config->SEED())+".data";
+    emp::Ptr<emp::DataFile> host_file = emp::NewPtr<emp::DataFile>(my_config->FILE_PATH()+"HostVals"+my_config->FILE_NAME()+file_ending);
+    host_file->AddVar(update, "update", "Update");
+    host_file->AddFun<double>([this](){ return GetMeanHostIntVal(); }, "mean_intval", "Average host interaction value");
+    host_file->AddFun<double>([this](){ return GetNumHosts(); }, "count", "Total number of hosts");
+    host_file->AddFun<double>([this](){ return GetNumUninfectedHosts(); }, "uninfected_host_count", "Total number of hosts that are uninfected");
+    AddHistColumns<double>(*host_file, [this](size_t bin){ return GetHostHistCount(bin); });
+    emp::Ptr<emp::DataFile> sym_file = emp::NewPtr<emp::DataFile>(my_config->FILE_PATH()+"SymVals"+my_config->FILE_NAME()+file_ending);
+    sym_file->AddVar(update, "update", "Update");
+    sym_file->AddFun<double>([this](){ return GetMeanSymIntVal(); }, "mean_intval", "Average symbiont interaction value");
+    sym_file->AddFun<double>([this](){ return GetNumSyms(); }, "count", "Total number of symbionts");
+    AddHistColumns<double>(*sym_file, [this](size_t bin){ return GetSymHistCount(bin); });
+    for (emp::Ptr<emp::DataFile> file : {host_file, sym_file}) {
+      file->SetTimingRepeat(my_config->DATA_INT());
+      file->PrintHeaderKeys();
+      files.push_back(file);
+    }
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To write the data files and advance the expected population one update.
+   */
+  void Update() {
+    for (emp::Ptr<emp::DataFile> file : files) file->Update(update);
+    if (GetNumHosts() > 0) Step();
+    for (double & count : uninfected) if (count < MEAN_FIELD_NEGLIGIBLE) count = 0;
+    for (double & count : infected) if (count < MEAN_FIELD_NEGLIGIBLE) count = 0;
+    update++;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To run UPDATES updates and then NO_MUT_UPDATES without mutation.
+   */
+  void RunExperiment(bool verbose=true) {
+    int num_updates = my_config->UPDATES();
+    for (int i = 0; i < num_updates; i++) {
+      if (verbose && (i%my_config->DATA_INT()) == 0) std::cout << "Update: " << i << std::endl;
+      Update();
+    }
+    int num_no_mut_updates = my_config->NO_MUT_UPDATES();
+    if (num_no_mut_updates > 0) SetMutationZero();
+    for (int i = 0; i < num_no_mut_updates; i++) {
+      if (verbose && (i%my_config->DATA_INT()) == 0) std::cout << "No mutation update: " << i << std::endl;
+      Update();
+    }
+  }
+
+private:
+  /**
+   * Input: An interaction value and the function to call with each bin and its share.
+   *
+   * Output: None
+   *
+   * Purpose: To split a value between the two bins around it, in the shares that
+   * keep its mean.
+   */
+  template <typename SHARE_FUN>
+  void ForEachSplitBin(double value, SHARE_FUN share_fun) const {
+    double position = (std::min(1.0, std::max(-1.0, value)) + 1.0) / 2.0 * (num_bins - 1);
+    size_t lower = std::min(num_bins - 2, (size_t) position);
+    double upper_share = position - lower;
+    if (upper_share < 1) share_fun(lower, 1 - upper_share);
+    if (upper_share > 0) share_fun(lower + 1, upper_share);
+  }
+
+  /**
+   * Input: The counts of offspring, how far apart two neighboring bins of the
+   * mutating trait are in the array, how many of them there are in a block, and
+   * the stencil.
+   *
+   * Output: None
+   *
+   * Purpose: To mutate one trait of a class array in place, leaving the others as
+   * they are. Interior bins are moved a whole run at a time, one weighted copy of
+   * the run per offset; edge bins follow the kernel.
+   */
+  void Mutate(emp::vector<double> & counts, size_t stride, size_t block, const MutationStencil & stencil) {
+    mutated.assign(counts.size(), 0);
+    size_t reach = stencil.reach;
+    for (size_t start = 0; start < counts.size(); start += stride * block) {
+      if (stencil.first_interior <= stencil.last_interior) {
+        size_t run_begin = start + stencil.first_interior * stride;
+        size_t run_end = start + (stencil.last_interior + 1) * stride;
+        for (size_t offset = 0; offset < stencil.weights.size(); offset++) {
+          double weight = stencil.weights[offset];
+          if (weight == 0) continue;
+          double * to = mutated.data() + run_begin + offset * stride - reach * stride;
+          const double * from = counts.data() + run_begin;
+          for (size_t i = 0; i < run_end - run_begin; i++) to[i] += from[i] * weight;
+        }
+      }
+      for (size_t bin : stencil.edge_bins) {
+        for (size_t i = start + bin * stride; i < start + (bin + 1) * stride; i++) {
+          if (counts[i] == 0) continue;
+          for (const auto & move : stencil.kernel[bin]) mutated[i + (move.first - bin) * stride] += counts[i] * move.second;
+        }
+      }
+    }
+    std::swap(counts, mutated);
+  }
+
+  void Step() {
+    double num_hosts = GetNumHosts();
+    std::fill(born_uninfected.begin(), born_uninfected.end(), 0);
+    std::fill(born_infected.begin(), born_infected.end(), 0);
+    std::fill(horiz_offspring.begin(), horiz_offspring.end(), 0);
+    double num_placed = 0;
+    for (size_t h = 0; h < num_bins; h++) {
+      double births = uninfected[h] * uninfected_births[h];
+      num_placed += births;
+      born_uninfected[h] += births;
+    }
+    for (size_t h = 0; h < num_bins; h++) {
+      for (size_t s = 0; s < num_bins; s++) {
+        double host_rate = infected_births[h * num_bins + s];
+        for (size_t k = 1; k <= sym_limit; k++) {
+          size_t i = InfectedIndex(h, s, k);
+          if (infected[i] == 0) continue;
+          double births = infected[i] * host_rate;
+          num_placed += births;
+          born_uninfected[h] += births * vert_count_shares[k][0];
+          for (size_t j = 1; j <= k; j++) born_infected[InfectedIndex(h, s, j)] += births * vert_count_shares[k][j];
+          horiz_offspring[s] += infected[i] * k * horiz_births[i];
+        }
+      }
+    }
+    Mutate(born_uninfected, 1, num_bins, host_stencil);
+    Mutate(born_infected, num_bins * sym_limit, num_bins, host_stencil);
+    Mutate(born_infected, sym_limit, num_bins, sym_stencil);
+    Mutate(horiz_offspring, 1, num_bins, sym_stencil);
+    for (double & count : horiz_offspring) if (count < MEAN_FIELD_NEGLIGIBLE) count = 0;
+
+    // placed offspring replace hosts in proportion to how many there are of each class
+    double num_victims = std::max(num_placed * num_hosts / num_cells, num_placed - (num_cells - num_hosts));
+    double survival = num_hosts > 0 ? std::max(0.0, 1 - num_victims / num_hosts) : 0;
+    for (size_t h = 0; h < num_bins; h++) uninfected[h] = uninfected[h] * survival + born_uninfected[h];
+    for (size_t i = 0; i < infected.size(); i++) infected[i] = infected[i] * survival + born_infected[i];
+
+    // each host is hit by a Poisson number of horizontally transmitted offspring and
+    // takes one in if it has room
+    double num_horiz = 0;
+    for (double count : horiz_offspring) num_horiz += count;
+    num_hosts = GetNumHosts();
+    if (num_horiz == 0 || num_hosts == 0 || sym_limit == 0) return;
+    double hit_chance = 1 - std::exp(-num_horiz / num_hosts);
+    for (size_t arrival = 0; arrival < num_bins; arrival++) arrival_shares[arrival] = horiz_offspring[arrival] / num_horiz;
+    // where k symbionts in bin s go when one arrives does not depend on the host
+    std::fill(merged_shares.begin(), merged_shares.end(), 0);
+    for (size_t merge = 0; merge < merged_shares.size(); merge += num_bins) {
+      for (size_t arrival = 0; arrival < num_bins; arrival++) {
+        if (arrival_shares[arrival] == 0) continue;
+        double upper_share = merge_upper_share[merge + arrival];
+        size_t lower = merge + merge_lower[merge + arrival];
+        merged_shares[lower] += arrival_shares[arrival] * (1 - upper_share);
+        if (upper_share > 0) merged_shares[lower + 1] += arrival_shares[arrival] * upper_share;
+      }
+    }
+    std::fill(newly_infected.begin(), newly_infected.end(), 0);
+    for (size_t h = 0; h < num_bins; h++) {
+      if (uninfected[h] == 0) continue;
+      double moving = uninfected[h] * hit_chance;
+      uninfected[h] -= moving;
+      for (size_t arrival = 0; arrival < num_bins; arrival++) {
+        newly_infected[InfectedIndex(h, arrival, 1)] += moving * arrival_shares[arrival];
+      }
+    }
+    for (size_t h = 0; h < num_bins; h++) {
+      for (size_t s = 0; s < num_bins; s++) {
+        for (size_t k = 1; k < sym_limit; k++) {
+          size_t i = InfectedIndex(h, s, k);
+          if (infected[i] == 0) continue;
+          double moving = infected[i] * hit_chance;
+          infected[i] -= moving;
+          size_t range = (k - 1) * num_bins + s;
+          size_t first_merged = InfectedIndex(h, 0, k + 1);
+          for (size_t merged = merge_first[range]; merged <= merge_last[range]; merged++) {
+            newly_infected[first_merged + merged * sym_limit] += moving * merged_shares[range * num_bins + merged];
+          }
+        }
+      }
+    }
+    for (size_t i = 0; i < infected.size(); i++) infected[i] += newly_infected[i];
+  }
+};
+#endif
@@ -0,0 +1,181 @@
+#ifndef METRICS_PAGE_H
+#define METRICS_PAGE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#ifndef __EMSCRIPTEN__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/**
+  *
+  * Purpose: Represents one set of live run metrics. Plain fixed-size fields only, so the
+  * layout is identical for the simulation and for any external reader of the page.
+  *
+*/
+struct MetricsSnapshot {
+  uint64_t update = 0;
+  double updates_per_sec = 0;
+  uint64_t host_count = 0;
+  uint64_t sym_count = 0;
+  uint64_t free_sym_count = 0;
+  double mean_host_intval = 0;
+  double mean_sym_intval = 0;
+  uint64_t burst_count = 0;
+  uint64_t rss_bytes = 0;
+  uint64_t avoided_host_births = 0;
+  uint64_t avoided_sym_births = 0;
+};
+
+/**
+  *
+  * Purpose: Represents a named POSIX shared-memory segment holding the latest
+  * MetricsSnapshot. The simulation is the only writer and publishes through a seqlock:
+  * the sequence is odd while a write is in progress, so readers never block the writer,
+  * they simply retry if the sequence changed underneath them.
+  *
+*/
+class MetricsPage {
+public:
+  /**
+    *
+    * Purpose: Identifies a segment written by this version of the layout.
+    *
+  */
+  static constexpr uint64_t MAGIC = 0x53594d4d45545232; // "SYMMETR2"
+
+private:
+  struct Layout {
+    uint64_t magic;
+    std::atomic<uint64_t> sequence;
+    MetricsSnapshot snapshot;
+  };
+
+  std::string name;
+  Layout * layout = nullptr;
+  bool owner = false;
+
+public:
+  /**
+   * Input: The name of the segment (e.g. "/symbulation") and whether to create it
+   * (the simulation) or to attach to an existing one read-only (a monitor).
+   *
+   * Output: None
+   *
+   * Purpose: To open and map the segment. IsOpen() reports whether this succeeded.
+   * Creating fails if a segment of that name already exists, so two runs never
+   * share (and unlink) one page.
+   */
+  MetricsPage(const std::string & _name, bool create) : name(_name), owner(create) {
+#ifndef __EMSCRIPTEN__
+    int fd = create ? shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644) : shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) return;
+    if (create && ftruncate(fd, sizeof(Layout)) != 0) {
+      close(fd);
+      return;
+    }
+    int prot = create ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void * addr = mmap(nullptr, sizeof(Layout), prot, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) return;
+    layout = static_cast<Layout *>(addr);
+    if (create) {
+      layout->sequence.store(0, std::memory_order_relaxed);
+      layout->snapshot = MetricsSnapshot();
+      layout->magic = MAGIC;
+    } else if (layout->magic != MAGIC) {
+      munmap(layout, sizeof(Layout));
+      layout = nullptr;
+    }
+#endif
+  }
+
+  MetricsPage(const MetricsPage &) = delete;
+  MetricsPage & operator=(const MetricsPage &) = delete;
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To unmap the segment, and to remove its name if this page created it.
+   */
+  ~MetricsPage() {
+#ifndef __EMSCRIPTEN__
+    if (layout) munmap(layout, sizeof(Layout));
+    if (layout && owner) shm_unlink(name.c_str());
+#endif
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: Whether the segment was successfully opened and mapped.
+   *
+   * Purpose: To check whether the page can be used.
+   */
+  bool IsOpen() const { return layout != nullptr; }
+
+  /**
+   * Input: The metrics to publish.
+   *
+   * Output: None
+   *
+   * Purpose: To replace the snapshot in the segment. Only the creating page should call this.
+   */
+  void Publish(const MetricsSnapshot & metrics) {
+    if (!layout) return;
+    uint64_t seq = layout->sequence.load(std::memory_order_relaxed);
+    layout->sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&layout->snapshot, &metrics, sizeof(MetricsSnapshot));
+    layout->sequence.store(seq + 2, std::memory_order_release);
+  }
+
+  /**
+   * Input: The snapshot to fill.
+   *
+   * Output: Whether a consistent snapshot was read.
+   *
+   * Purpose: To copy the latest snapshot out of the segment without ever blocking the writer.
+   */
+  bool Read(MetricsSnapshot & metrics) const {
+    if (!layout) return false;
+    for (int attempt = 0; attempt < 1000; attempt++) {
+      uint64_t before = layout->sequence.load(std::memory_order_acquire);
+      if (before % 2 == 1) continue;
+      std::memcpy(&metrics, &layout->snapshot, sizeof(MetricsSnapshot));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (layout->sequence.load(std::memory_order_relaxed) == before) return true;
+    }
+    return false;
+  }
+};
+
+/**
+ * Input: None
+ *
+ * Output: The resident set size of this process in bytes, 0 if unavailable.
+ *
+ * Purpose: To report memory use on the metrics page.
+ */
+inline uint64_t GetResidentBytes() {
+#ifndef __EMSCRIPTEN__
+  FILE * statm = fopen("/proc/self/statm", "r");
+  if (!statm) return 0;
+  unsigned long size = 0, resident = 0;
+  int read = fscanf(statm, "%lu %lu", &size, &resident);
+  fclose(statm);
+  if (read != 2) return 0;
+  return (uint64_t) resident * (uint64_t) sysconf(_SC_PAGESIZE);
+#else
+  return 0;
+#endif
+}
+#endif
@@ -0,0 +1,124 @@
+#ifndef PAIR_STATS_H
+#define PAIR_STATS_H
+
+#include "../../Empirical/include/emp/data/DataNode.hpp"
+#include "../Organism.h"
+#include <functional>
+#include <math.h>
+
+/**
+  *
+  * Purpose: Accumulates statistics over (host trait, hosted symbiont trait) pairs,
+  * e.g. host interaction value against the interaction values of its symbionts:
+  * the covariance and correlation of the pair, and a histogram of their absolute
+  * difference (mismatch). It is filled from SymWorld's host traversal rather than
+  * scanning the population itself.
+  *
+*/
+class PairStats {
+private:
+  std::function<double(Organism &)> host_trait;
+  std::function<double(Organism &)> sym_trait;
+
+  // running (Welford) moments of the pairs
+  size_t count = 0;
+  double mean_host = 0;
+  double mean_sym = 0;
+  double m2_host = 0;
+  double m2_sym = 0;
+  double co_moment = 0;
+
+  emp::DataMonitor<double, emp::data::Histogram> mismatch;
+
+public:
+  /**
+   * Input: How to read the trait from hosts and from symbionts, and the range and
+   * number of bins of the mismatch histogram.
+   *
+   * Output: None
+   *
+   * Purpose: To construct an empty set of pair statistics.
+   */
+  PairStats(std::function<double(Organism &)> _host_trait, std::function<double(Organism &)> _sym_trait,
+            double mismatch_min, double mismatch_max, size_t mismatch_bins)
+    : host_trait(_host_trait), sym_trait(_sym_trait) {
+    mismatch.SetupBins(mismatch_min, mismatch_max, mismatch_bins);
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To clear the statistics, at the start of each traversal.
+   */
+  void Reset() {
+    count = 0;
+    mean_host = mean_sym = m2_host = m2_sym = co_moment = 0;
+    mismatch.Reset();
+  }
+
+  /**
+   * Input: A host's trait value and one of its symbionts' trait value.
+   *
+   * Output: None
+   *
+   * Purpose: To add one pair to the statistics.
+   */
+  void AddPair(double host_val, double sym_val) {
+    count++;
+    double host_delta = host_val - mean_host;
+    mean_host += host_delta / count;
+    double sym_delta = sym_val - mean_sym;
+    mean_sym += sym_delta / count;
+    m2_host += host_delta * (host_val - mean_host);
+    m2_sym += sym_delta * (sym_val - mean_sym);
+    co_moment += host_delta * (sym_val - mean_sym);
+    mismatch.AddDatum(fabs(host_val - sym_val));
+  }
+
+  /**
+   * Input: A host and one of its symbionts.
+   *
+   * Output: None
+   *
+   * Purpose: To add the pair formed by their traits.
+   */
+  void AddPair(Organism & host, Organism & sym) { AddPair(host_trait(host), sym_trait(sym)); }
+
+  size_t GetCount() const { return count; }
+  double GetHostMean() const { return count ? mean_host : NAN; }
+  double GetSymMean() const { return count ? mean_sym : NAN; }
+
+  /**
+   * Input: None
+   *
+   * Output: The (population) covariance of host and symbiont values, NaN with no pairs.
+   *
+   * Purpose: To measure how host and symbiont traits vary together.
+   */
+  double GetCovariance() const { return count ? co_moment / count : NAN; }
+
+  /**
+   * Input: None
+   *
+   * Output: The Pearson correlation of host and symbiont values, NaN with no pairs
+   * or when either trait does not vary.
+   *
+   * Purpose: To measure partner fidelity.
+   */
+  double GetCorrelation() const {
+    if (count == 0 || m2_host <= 0 || m2_sym <= 0) return NAN;
+    return co_moment / sqrt(m2_host * m2_sym);
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The DataMonitor of |host value - symbiont value| for every pair.
+   *
+   * Purpose: To access the mismatch distribution, e.g. to add its mean and bins to a data file.
+   */
+  emp::DataMonitor<double, emp::data::Histogram> & GetMismatchDataNode() { return mismatch; }
+};
+#endif
@@ -0,0 +1,100 @@
+#ifndef POPULATION_FILE_H
+#define POPULATION_FILE_H
+
+#include "SymWorld.h"
+#include "Checkpoint.h"
+#include "../ConfigSetup.h"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+/**
+ * Input: The world, the name of a CSV population file, and functions that make a
+ * host and a symbiont of the world's mode from an interaction value.
+ *
+ * Output: None
+ *
+ * Purpose: To add the population described by a CSV file to the world. Each row is
+ * cell,host_int_val,sym_int_vals: the cell's index, the interaction value of its
+ * host (empty for no host) and the interaction values of its symbionts separated
+ * by spaces. Without a host, the cell can hold one free-living symbiont (with
+ * FREE_LIVING_SYMS on). A first row starting with "cell" is taken as a header.
+ * Traits other than the interaction value come from the settings, as they do when
+ * the population is built from scratch.
+ */
+template <typename MAKE_HOST, typename MAKE_SYM>
+void LoadPopulationCSV(emp::Ptr<SymWorld> world, emp::Ptr<SymConfigBase> my_config, const std::string & filename,
+                       MAKE_HOST make_host, MAKE_SYM make_sym) {
+  std::ifstream in(filename);
+  if (!in) throw "Could not open population file";
+  emp::vector<bool> seen(world->GetSize(), false);
+  std::string line;
+  bool first_line = true;
+  while (std::getline(in, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (first_line && line.compare(0, 4, "cell") == 0) {
+      first_line = false;
+      continue;
+    }
+    first_line = false;
+    if (line.find_first_not_of(" ") == std::string::npos) continue;
+
+    std::stringstream fields(line);
+    std::string cell_text, host_text, syms_text;
+    std::getline(fields, cell_text, ',');
+    std::getline(fields, host_text, ',');
+    std::getline(fields, syms_text, ',');
+    char * end = nullptr;
+    size_t cell = strtoul(cell_text.c_str(), &end, 10);
+    if (end == cell_text.c_str()) throw "Population file rows must start with a cell index";
+    if (cell >= world->GetSize()) throw "Population file names a cell outside the world";
+    if (seen[cell]) throw "Population file names a cell more than once";
+    seen[cell] = true;
+
+    emp::vector<double> sym_int_vals;
+    std::stringstream syms(syms_text);
+    double sym_int_val;
+    while (syms >> sym_int_val) sym_int_vals.push_back(sym_int_val);
+
+    if (host_text.find_first_not_of(" ") != std::string::npos) {
+      emp::Ptr<Organism> host = make_host(strtod(host_text.c_str(), nullptr));
+      world->AddOrgAt(host, emp::WorldPosition(cell));
+      for (double int_val : sym_int_vals) {
+        emp::Ptr<Organism> sym = make_sym(int_val);
+        if (my_config->PHYLOGENY()) world->AddSymToSystematic(sym);
+        host->AddSymbiont(sym);
+      }
+    } else if (sym_int_vals.size() > 0) {
+      if (my_config->FREE_LIVING_SYMS() == 0) throw "Population file has symbionts without a host, which needs FREE_LIVING_SYMS";
+      if (sym_int_vals.size() > 1) throw "Population file has more than one free-living symbiont in a cell";
+      emp::Ptr<Organism> sym = make_sym(sym_int_vals[0]);
+      if (my_config->PHYLOGENY()) world->AddSymToSystematic(sym);
+      world->AddOrgAt(sym, emp::WorldPosition(0, cell));
+    }
+  }
+}
+
+/**
+ * Input: The world, its settings, and functions that make a host and a symbiont of
+ * the world's mode from an interaction value.
+ *
+ * Output: Whether the population came from a file.
+ *
+ * Purpose: When POP_FILE is set, to size the world and fill it from that file
+ * instead of building the population from HOST_INT, SYM_INT and START_MOI. The file
+ * is either a checkpoint (whose population is taken, but not its update or random
+ * state) or a CSV as read by LoadPopulationCSV. Called by the world setups once
+ * the population structure is set.
+ */
+template <typename MAKE_HOST, typename MAKE_SYM>
+bool SeedPopulationFromFile(emp::Ptr<SymWorld> world, emp::Ptr<SymConfigBase> my_config,
+                            MAKE_HOST make_host, MAKE_SYM make_sym) {
+  std::string filename = my_config->POP_FILE();
+  if (filename == "") return false;
+  world->Resize(my_config->GRID_X(), my_config->GRID_Y());
+  if (IsCheckpointFile(filename)) world->LoadPopulation(filename);
+  else LoadPopulationCSV(world, my_config, filename, make_host, make_sym);
+  return true;
+}
+#endif
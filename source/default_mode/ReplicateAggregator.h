@@ -0,0 +1,280 @@
+#ifndef REPLICATE_AGGREGATOR_H
+#define REPLICATE_AGGREGATOR_H
+
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "CapturingDataFile.h"
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <math.h>
+#include <string>
+
+/**
+  *
+  * Purpose: Running (Welford) count, mean and variance of a stream of values.
+  * Two sets of statistics can be merged (Chan et al.'s pairwise update), so partial
+  * results kept for different replicates or threads combine exactly.
+  *
+*/
+class RunningStats {
+private:
+  size_t count = 0;
+  double mean = 0;
+  double m2 = 0;
+
+public:
+  /**
+   * Input: The value to add. NaN values (e.g. the mean of an empty population) are skipped.
+   *
+   * Output: None
+   *
+   * Purpose: To add one value to the statistics.
+   */
+  void Add(double value) {
+    if (std::isnan(value)) return;
+    count++;
+    double delta = value - mean;
+    mean += delta / count;
+    m2 += delta * (value - mean);
+  }
+
+  /**
+   * Input: Other statistics.
+   *
+   * Output: None
+   *
+   * Purpose: To combine other statistics into these, as if all of their values had been added here.
+   */
+  void Merge(const RunningStats & other) {
+    if (other.count == 0) return;
+    if (count == 0) {
+      *this = other;
+      return;
+    }
+    size_t total = count + other.count;
+    double delta = other.mean - mean;
+    mean += delta * other.count / total;
+    m2 += other.m2 + delta * delta * ((double) count * other.count / total);
+    count = total;
+  }
+
+  size_t GetCount() const { return count; }
+  double GetMean() const { return count ? mean : NAN; }
+
+  /**
+   * Input: None
+   *
+   * Output: The sample variance, NaN with fewer than two values.
+   *
+   * Purpose: To measure the spread across replicates.
+   */
+  double GetVariance() const { return count > 1 ? m2 / (count - 1) : NAN; }
+
+  /**
+   * Input: None
+   *
+   * Output: The half-width of the 95% confidence interval of the mean (using the t
+   * distribution, which matters for the handful of replicates usually run), NaN with
+   * fewer than two values.
+   *
+   * Purpose: To report the mean as mean +/- this value.
+   */
+  double GetConfidence95() const {
+    static const double t_95[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                  2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                  2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    if (count < 2) return NAN;
+    size_t df = count - 1;
+    double t = df <= 30 ? t_95[df - 1] : 1.96;
+    return t * sqrt(GetVariance() / count);
+  }
+};
+
+/**
+  *
+  * Purpose: Combines the data files of several replicates run side by side into one
+  * file per kind of data file. Each replicate reports its rows as they are written;
+  * once every replicate has reported a row for an update, the aggregated row (the
+  * mean, variance and 95% CI half-width of each column across replicates) is written
+  * and its statistics are dropped.
+  *
+*/
+class ReplicateAggregator {
+private:
+  struct Step {
+    emp::vector<RunningStats> columns;
+    size_t reports = 0;
+  };
+
+  struct Output {
+    emp::Ptr<std::ofstream> out;
+    size_t num_columns = 0;
+    std::map<std::string, Step> pending; // keyed by the row's first field (the update)
+  };
+
+  size_t num_replicates;
+  std::string label;
+  std::map<std::string, Output> outputs;
+
+  /**
+   * Input: One CSV row.
+   *
+   * Output: Its fields.
+   *
+   * Purpose: To split a data file row.
+   */
+  static emp::vector<std::string> SplitRow(const std::string & row) {
+    emp::vector<std::string> fields;
+    size_t start = 0;
+    while (true) {
+      size_t end = row.find(',', start);
+      fields.push_back(row.substr(start, end == std::string::npos ? std::string::npos : end - start));
+      if (end == std::string::npos) break;
+      start = end + 1;
+    }
+    return fields;
+  }
+
+public:
+  /**
+   * Input: The number of replicates that will report, and the label that replaces
+   * a replicate's _SEED<seed> in aggregated file names (e.g. "_SEEDS10-19").
+   *
+   * Output: None
+   *
+   * Purpose: To construct an aggregator with no files yet.
+   */
+  ReplicateAggregator(size_t _num_replicates, const std::string & _label)
+    : num_replicates(_num_replicates), label(_label) {}
+
+  ReplicateAggregator(const ReplicateAggregator &) = delete;
+  ReplicateAggregator & operator=(const ReplicateAggregator &) = delete;
+
+  ~ReplicateAggregator() {
+    for (auto & output : outputs) output.second.out.Delete();
+  }
+
+  size_t GetNumReplicates() const { return num_replicates; }
+
+  /**
+   * Input: The name of one replicate's data file.
+   *
+   * Output: The name of the aggregated file it contributes to: the same name with
+   * _SEED<seed> replaced by the aggregator's label (or the label added before the
+   * extension if there is no seed in the name).
+   *
+   * Purpose: To pair up the files of different replicates.
+   */
+  std::string GetAggregateName(const std::string & filename) const {
+    size_t seed = filename.rfind("_SEED");
+    if (seed != std::string::npos) {
+      size_t end = seed + 5;
+      while (end < filename.size() && isdigit(filename[end])) end++;
+      return filename.substr(0, seed) + label + filename.substr(end);
+    }
+    size_t dot = filename.rfind('.');
+    if (dot == std::string::npos || filename.find('/', dot) != std::string::npos) return filename + label;
+    return filename.substr(0, dot) + label + filename.substr(dot);
+  }
+
+  /**
+   * Input: The aggregated file's name and a replicate's header row.
+   *
+   * Output: None
+   *
+   * Purpose: To open the aggregated file and write its header the first time any
+   * replicate announces it: the first column is kept, every other column becomes
+   * <column>_mean, <column>_var and <column>_ci95.
+   */
+  void SetHeader(const std::string & name, const std::string & header) {
+    if (outputs.count(name)) return;
+    Output & output = outputs[name];
+    output.out = emp::NewPtr<std::ofstream>(name);
+    emp::vector<std::string> keys = SplitRow(header);
+    output.num_columns = keys.size();
+    *output.out << keys[0];
+    for (size_t i = 1; i < keys.size(); i++) {
+      *output.out << ',' << keys[i] << "_mean," << keys[i] << "_var," << keys[i] << "_ci95";
+    }
+    *output.out << '\n';
+  }
+
+  /**
+   * Input: The aggregated file's name and one replicate's row.
+   *
+   * Output: None
+   *
+   * Purpose: To add a replicate's row to the statistics for its update, writing
+   * the aggregated row once every replicate has reported it.
+   */
+  void AddRow(const std::string & name, const std::string & row) {
+    auto found = outputs.find(name);
+    if (found == outputs.end()) throw "A replicate reported a row before its file's header";
+    Output & output = found->second;
+    emp::vector<std::string> fields = SplitRow(row);
+    Step & step = output.pending[fields[0]];
+    if (step.columns.size() == 0) step.columns.resize(output.num_columns);
+    for (size_t i = 1; i < fields.size() && i < output.num_columns; i++) {
+      step.columns[i].Add(fields[i].empty() ? NAN : strtod(fields[i].c_str(), nullptr));
+    }
+    if (++step.reports < num_replicates) return;
+
+    std::ofstream & out = *output.out;
+    out << fields[0];
+    for (size_t i = 1; i < output.num_columns; i++) {
+      const RunningStats & stats = step.columns[i];
+      out << ',' << stats.GetMean() << ',' << stats.GetVariance() << ',' << stats.GetConfidence95();
+    }
+    out << '\n';
+    out.flush();
+    output.pending.erase(fields[0]);
+  }
+};
+
+/**
+  *
+  * Purpose: A DataFile of one replicate, which reports its header and rows to a
+  * ReplicateAggregator and, optionally, still writes its own file.
+  *
+*/
+class ReplicateDataFile : public CapturingDataFile {
+private:
+  ReplicateAggregator & aggregator;
+  std::string aggregate_name;
+
+public:
+  /**
+   * Input: The replicate's file name and the aggregator to report to.
+   *
+   * Output: None
+   *
+   * Purpose: To construct a file that is written to disk and aggregated.
+   */
+  ReplicateDataFile(const std::string & filename, ReplicateAggregator & _aggregator)
+    : CapturingDataFile(filename), aggregator(_aggregator), aggregate_name(_aggregator.GetAggregateName(filename)) {}
+
+  /**
+   * Input: Where to write the replicate's own rows instead of its file (e.g.
+   * CapturingDataFile::GetNullStream() to write none), the file name it would have
+   * had, and the aggregator to report to.
+   *
+   * Output: None
+   *
+   * Purpose: To construct a file that is aggregated without writing a per-seed file.
+   */
+  ReplicateDataFile(std::ostream & out, const std::string & filename, ReplicateAggregator & _aggregator)
+    : CapturingDataFile(out), aggregator(_aggregator), aggregate_name(_aggregator.GetAggregateName(filename)) {}
+
+  void PrintHeaderKeys() override {
+    aggregator.SetHeader(aggregate_name, CaptureHeader());
+  }
+
+  void Update() override {
+    aggregator.AddRow(aggregate_name, CaptureRow());
+  }
+
+  using emp::DataFile::Update;
+};
+#endif
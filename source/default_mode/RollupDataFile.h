@@ -0,0 +1,269 @@
+#ifndef ROLLUP_DATA_FILE_H
+#define ROLLUP_DATA_FILE_H
+
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "CapturingDataFile.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <math.h>
+#include <sstream>
+#include <string>
+
+/**
+  *
+  * Purpose: The count, sum, minimum and maximum of one column over a window of rows.
+  * Windows merge, so a longer window is built from the shorter windows it contains.
+  *
+*/
+struct RollupStats {
+  size_t count = 0;
+  double sum = 0;
+  double min = 0;
+  double max = 0;
+
+  /**
+   * Input: The value to add. NaN values are skipped.
+   *
+   * Output: None
+   *
+   * Purpose: To add one row's value to the window.
+   */
+  void Add(double value) {
+    if (std::isnan(value)) return;
+    min = count ? std::min(min, value) : value;
+    max = count ? std::max(max, value) : value;
+    sum += value;
+    count++;
+  }
+
+  /**
+   * Input: The statistics of a shorter window.
+   *
+   * Output: None
+   *
+   * Purpose: To fold a shorter window into this one.
+   */
+  void Merge(const RollupStats & other) {
+    if (other.count == 0) return;
+    min = count ? std::min(min, other.min) : other.min;
+    max = count ? std::max(max, other.max) : other.max;
+    sum += other.sum;
+    count += other.count;
+  }
+
+  double GetMean() const { return count ? sum / count : NAN; }
+};
+
+/**
+ * Input: The spans to roll up over, as update counts separated by commas (e.g. "10,100,1000").
+ *
+ * Output: The spans. Each must be a multiple of the one before it.
+ *
+ * Purpose: To read the ROLLUP_LEVELS setting.
+ */
+emp::vector<size_t> ParseRollupSpans(const std::string & spans_text) {
+  emp::vector<size_t> spans;
+  std::stringstream ss(spans_text);
+  std::string span_text;
+  while (std::getline(ss, span_text, ',')) {
+    if (span_text.find_first_not_of(" ") == std::string::npos) continue;
+    long span = strtol(span_text.c_str(), nullptr, 10);
+    if (span <= 0) throw "Rollup spans must be positive numbers of updates";
+    if (spans.size() && span % spans.back() != 0) throw "Each rollup span must be a multiple of the one before it";
+    spans.push_back(span);
+  }
+  return spans;
+}
+
+/**
+  *
+  * Purpose: A DataFile for long runs. Instead of every row, its own file only keeps
+  * the most recent rows at full resolution (rewritten as each window of the
+  * shortest span completes, and when the file is closed), and
+  * for each rollup span (e.g. 10, 100 and 1000 updates) it writes the mean, minimum
+  * and maximum of every column over each window of that span to a file of its own,
+  * as soon as the window is complete. Each span is rolled up from the one below it.
+  *
+*/
+class RollupDataFile : public CapturingDataFile {
+private:
+  struct Level {
+    size_t span;
+    emp::Ptr<std::ofstream> out;
+    bool has_window = false;
+    size_t window_start = 0;
+    size_t rows = 0;
+    emp::vector<RollupStats> columns;
+  };
+
+  std::string filename;
+  emp::vector<Level> levels;
+  size_t num_columns = 0;
+  std::string header;
+  emp::vector<std::string> recent; // ring of the most recent rows
+  size_t recent_next = 0;
+  size_t recent_count = 0;
+
+  /**
+   * Input: The index of the level to write.
+   *
+   * Output: None
+   *
+   * Purpose: To write a level's current window as one row, folding it into the next
+   * level's window, and to close it.
+   */
+  void FlushLevel(size_t level_id) {
+    Level & level = levels[level_id];
+    if (!level.has_window) return;
+    std::ofstream & out = *level.out;
+    out << level.window_start << ',' << level.rows;
+    for (size_t i = 1; i < num_columns; i++) {
+      const RollupStats & stats = level.columns[i];
+      out << ',' << stats.GetMean() << ',' << (stats.count ? stats.min : NAN) << ',' << (stats.count ? stats.max : NAN);
+    }
+    out << '\n';
+    out.flush();
+
+    if (level_id + 1 < levels.size()) {
+      Level & next = levels[level_id + 1];
+      size_t next_start = level.window_start / next.span * next.span;
+      if (next.has_window && next.window_start != next_start) FlushLevel(level_id + 1);
+      StartWindow(next, next_start);
+      for (size_t i = 1; i < num_columns; i++) next.columns[i].Merge(level.columns[i]);
+      next.rows += level.rows;
+    }
+    level.has_window = false;
+  }
+
+  /**
+   * Input: A level and the first update of the window it should be in.
+   *
+   * Output: None
+   *
+   * Purpose: To open a new, empty window if the level is not already in one.
+   */
+  void StartWindow(Level & level, size_t window_start) {
+    if (level.has_window) return;
+    level.has_window = true;
+    level.window_start = window_start;
+    level.rows = 0;
+    level.columns.assign(num_columns, RollupStats());
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To rewrite the file itself with the header and the recent rows.
+   */
+  void WriteRecent() {
+    std::ofstream out(filename, std::ios::trunc);
+    if (header != "") out << header << '\n';
+    for (size_t i = 0; i < recent_count; i++) {
+      out << recent[(recent_next + recent.size() - recent_count + i) % recent.size()] << '\n';
+    }
+  }
+
+public:
+  /**
+   * Input: The file's name, the spans to roll up over (ascending, each a multiple of
+   * the one before), and how many recent full-resolution rows to keep.
+   *
+   * Output: None
+   *
+   * Purpose: To construct a rollup file. Each span's rows go to the file's name with
+   * _rollup<span> added before the extension.
+   */
+  RollupDataFile(const std::string & _filename, const emp::vector<size_t> & spans, size_t num_recent)
+    : CapturingDataFile(_filename), filename(_filename), recent(num_recent) {
+    for (size_t span : spans) {
+      Level level;
+      level.span = span;
+      levels.push_back(level);
+    }
+  }
+
+  RollupDataFile(const RollupDataFile &) = delete;
+  RollupDataFile & operator=(const RollupDataFile &) = delete;
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To write the final, partial windows and the recent rows.
+   */
+  ~RollupDataFile() {
+    if (levels.size()) FlushLevel(0);
+    for (size_t i = 1; i < levels.size(); i++) FlushLevel(i);
+    for (Level & level : levels) if (level.out) level.out.Delete();
+    WriteRecent();
+  }
+
+  /**
+   * Input: The span of one of the file's levels.
+   *
+   * Output: The name of the file that level is written to.
+   *
+   * Purpose: To name the rollup files.
+   */
+  std::string GetLevelFilename(size_t span) const {
+    std::string suffix = "_rollup" + std::to_string(span);
+    size_t dot = filename.rfind('.');
+    if (dot == std::string::npos || filename.find('/', dot) != std::string::npos) return filename + suffix;
+    return filename.substr(0, dot) + suffix + filename.substr(dot);
+  }
+
+  void PrintHeaderKeys() override {
+    header = CaptureHeader(false);
+    std::stringstream ss(header);
+    emp::vector<std::string> keys;
+    std::string key;
+    while (std::getline(ss, key, ',')) keys.push_back(key);
+    num_columns = keys.size();
+    for (Level & level : levels) {
+      if (level.out) continue;
+      level.out = emp::NewPtr<std::ofstream>(GetLevelFilename(level.span));
+      *level.out << keys[0] << ",rows";
+      for (size_t i = 1; i < keys.size(); i++) *level.out << ',' << keys[i] << "_mean," << keys[i] << "_min," << keys[i] << "_max";
+      *level.out << '\n';
+    }
+  }
+
+  void Update() override {
+    std::string row = CaptureRow(false);
+    if (recent.size()) {
+      recent[recent_next] = row;
+      recent_next = (recent_next + 1) % recent.size();
+      if (recent_count < recent.size()) recent_count++;
+    }
+    if (levels.size() == 0 || num_columns == 0) return;
+
+    // split the row and add it to the shortest span's window
+    emp::vector<double> values(num_columns, NAN);
+    size_t start = 0;
+    for (size_t i = 0; i < num_columns; i++) {
+      size_t end = row.find(',', start);
+      std::string field = row.substr(start, end == std::string::npos ? std::string::npos : end - start);
+      if (!field.empty()) values[i] = strtod(field.c_str(), nullptr);
+      if (end == std::string::npos) break;
+      start = end + 1;
+    }
+    size_t row_update = std::isnan(values[0]) ? 0 : (size_t) values[0];
+    Level & first = levels[0];
+    size_t window_start = row_update / first.span * first.span;
+    if (first.has_window && first.window_start != window_start) {
+      FlushLevel(0);
+      WriteRecent();
+    }
+    StartWindow(first, window_start);
+    for (size_t i = 1; i < num_columns; i++) first.columns[i].Add(values[i]);
+    first.rows++;
+  }
+
+  using emp::DataFile::Update;
+};
+#endif
@@ -0,0 +1,472 @@
+#ifndef ROW_STREAM_H
+#define ROW_STREAM_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../../Empirical/include/emp/data/DataFile.hpp"
+#include "CapturingDataFile.h"
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#ifndef __EMSCRIPTEN__
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+/**
+  *
+  * Purpose: A bounded single-producer/single-consumer queue. Push and Pop never
+  * block or allocate; Push simply fails when the queue is full.
+  *
+*/
+template <typename T, size_t CAPACITY>
+class FrameQueue {
+private:
+  std::array<T, CAPACITY> slots;
+  alignas(64) std::atomic<size_t> head{0}; // next slot to pop, owned by the consumer
+  alignas(64) std::atomic<size_t> tail{0}; // next slot to push, owned by the producer
+
+public:
+  /**
+   * Input: The item to enqueue (moved from only on success).
+   *
+   * Output: Whether there was room for it.
+   *
+   * Purpose: To add an item from the producer thread.
+   */
+  bool Push(T && item) {
+    size_t cur_tail = tail.load(std::memory_order_relaxed);
+    if (cur_tail - head.load(std::memory_order_acquire) == CAPACITY) return false;
+    slots[cur_tail % CAPACITY] = std::move(item);
+    tail.store(cur_tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Input: Where to move the dequeued item.
+   *
+   * Output: Whether an item was available.
+   *
+   * Purpose: To take the oldest item from the consumer thread.
+   */
+  bool Pop(T & item) {
+    size_t cur_head = head.load(std::memory_order_relaxed);
+    if (cur_head == tail.load(std::memory_order_acquire)) return false;
+    item = std::move(slots[cur_head % CAPACITY]);
+    head.store(cur_head + 1, std::memory_order_release);
+    return true;
+  }
+};
+
+/**
+  *
+  * Purpose: Publishes frames (data file rows, raster snapshots) to every subscriber
+  * of a Unix-domain socket. Frames are "<source>\t<payload>" packets on a SOCK_SEQPACKET
+  * socket, so each one arrives whole. The simulation thread only pushes into a bounded
+  * lock-free queue (rasters into a single slot, where a newer raster replaces one not
+  * yet sent) and wakes a background thread, which does all socket work and otherwise
+  * sleeps until there is a frame or a subscriber to accept. When the queue is full,
+  * or a subscriber's socket buffer is, the frame is dropped rather than waiting.
+  *
+*/
+class RowStream {
+public:
+  static constexpr size_t QUEUE_SIZE = 1024;
+  static constexpr int SOCKET_BUFFER_SIZE = 1 << 22;
+
+private:
+  /**
+    *
+    * Purpose: Represents one queued frame. Header frames are only sent to subscribers
+    * that have not already received that source's header when they connected.
+    *
+  */
+  struct Frame {
+    std::string source;
+    std::string packet;
+    bool is_header = false;
+  };
+
+  /**
+    *
+    * Purpose: Represents a connected subscriber and the sources whose headers it has.
+    *
+  */
+  struct Subscriber {
+    int fd;
+    std::set<std::string> headers_sent;
+  };
+
+  std::string path;
+  int listen_fd = -1;
+  int wake_fds[2] = {-1, -1}; // pipe written to wake the publisher thread
+  FrameQueue<Frame, QUEUE_SIZE> queue;
+  std::atomic<Frame *> latest_raster{nullptr}; // owned; replaced by newer rasters until sent
+  std::atomic<bool> running{false};
+  std::atomic<size_t> dropped{0};
+  std::thread publisher;
+
+  /**
+    *
+    * Purpose: Represents the header packet of each streamed source, sent to every
+    * subscriber when it connects. Only written while files are being set up, and only
+    * held by the publisher thread long enough to copy it.
+    *
+  */
+  std::map<std::string, std::string> headers;
+  std::mutex headers_mutex;
+
+#ifndef __EMSCRIPTEN__
+  /**
+   * Input: The connected subscribers, and the frame to send.
+   *
+   * Output: None
+   *
+   * Purpose: To send one frame to every subscriber without blocking, dropping
+   * subscribers that have gone away.
+   */
+  void Broadcast(emp::vector<Subscriber> & subscribers, const Frame & frame) {
+    for (size_t i = 0; i < subscribers.size();) {
+      Subscriber & subscriber = subscribers[i];
+      if (frame.is_header && !subscriber.headers_sent.insert(frame.source).second) {
+        i++;
+        continue;
+      }
+      ssize_t sent = send(subscriber.fd, frame.packet.data(), frame.packet.size(), MSG_DONTWAIT | MSG_NOSIGNAL);
+      if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EMSGSIZE) {
+        close(subscriber.fd);
+        subscribers[i] = subscribers.back();
+        subscribers.pop_back();
+        continue;
+      }
+      if (sent < 0) dropped.fetch_add(1, std::memory_order_relaxed); //slow subscriber, or a frame too big for one packet
+      i++;
+    }
+  }
+
+  /**
+   * Input: The connected subscribers.
+   *
+   * Output: None
+   *
+   * Purpose: To accept a new subscriber and send it the header of every source so
+   * far, without blocking and without holding the headers while sending.
+   */
+  void Accept(emp::vector<Subscriber> & subscribers) {
+    int fd = accept(listen_fd, nullptr, nullptr);
+    if (fd < 0) return;
+    int buffer_size = SOCKET_BUFFER_SIZE; //room for whole rasters of large worlds
+    setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &buffer_size, sizeof(buffer_size));
+    std::map<std::string, std::string> current_headers;
+    {
+      std::lock_guard<std::mutex> lock(headers_mutex);
+      current_headers = headers;
+    }
+    Subscriber subscriber{fd, {}};
+    for (const auto & header : current_headers) {
+      ssize_t sent = send(fd, header.second.data(), header.second.size(), MSG_DONTWAIT | MSG_NOSIGNAL);
+      if (sent < 0) dropped.fetch_add(1, std::memory_order_relaxed);
+      else subscriber.headers_sent.insert(header.first);
+    }
+    subscribers.push_back(subscriber);
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To wake the publisher thread, from any thread. Never blocks: if the
+   * pipe is full, the thread already has a wake-up waiting.
+   */
+  void Wake() {
+    char byte = 0;
+    ssize_t written = write(wake_fds[1], &byte, 1);
+    (void) written;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: The publisher thread: wait for subscribers to accept and frames to
+   * forward, and handle them until stopped, then flush what is left.
+   */
+  void Publish() {
+    emp::vector<Subscriber> subscribers;
+    Frame frame;
+    while (true) {
+      pollfd polls[2] = {{listen_fd, POLLIN, 0}, {wake_fds[0], POLLIN, 0}};
+      poll(polls, 2, -1);
+      bool stopping = !running.load(std::memory_order_acquire);
+      if (polls[1].revents & POLLIN) {
+        char buffer[64];
+        while (read(wake_fds[0], buffer, sizeof(buffer)) > 0) {}
+      }
+      if (polls[0].revents & POLLIN) Accept(subscribers);
+      // rows queued before the raster was pushed go out before it
+      Frame * raster = latest_raster.exchange(nullptr, std::memory_order_acquire);
+      while (queue.Pop(frame)) Broadcast(subscribers, frame);
+      if (raster) {
+        Broadcast(subscribers, *raster);
+        delete raster;
+      }
+      if (stopping) break;
+    }
+    for (Subscriber & subscriber : subscribers) close(subscriber.fd);
+  }
+#endif
+
+  /**
+   * Input: The frame to queue.
+   *
+   * Output: Whether there was room for it.
+   *
+   * Purpose: To queue a frame, counting it as dropped if the queue is full.
+   */
+  bool Enqueue(Frame && frame) {
+    if (listen_fd < 0) return false;
+    if (!queue.Push(std::move(frame))) {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+#ifndef __EMSCRIPTEN__
+    Wake();
+#endif
+    return true;
+  }
+
+public:
+  /**
+   * Input: The filesystem path of the socket to create.
+   *
+   * Output: None
+   *
+   * Purpose: To bind the socket and start the publisher thread. IsOpen() reports
+   * whether this succeeded.
+   */
+  RowStream(const std::string & _path) : path(_path) {
+#ifndef __EMSCRIPTEN__
+    sockaddr_un addr = {};
+    if (path.size() >= sizeof(addr.sun_path)) return;
+    addr.sun_family = AF_UNIX;
+    path.copy(addr.sun_path, path.size());
+    unlink(path.c_str());
+    if (pipe(wake_fds) != 0) return;
+    fcntl(wake_fds[0], F_SETFL, O_NONBLOCK);
+    fcntl(wake_fds[1], F_SETFL, O_NONBLOCK);
+    listen_fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (listen_fd >= 0 && (bind(listen_fd, (sockaddr *) &addr, sizeof(addr)) != 0 || listen(listen_fd, 16) != 0)) {
+      close(listen_fd);
+      listen_fd = -1;
+    }
+    if (listen_fd < 0) {
+      close(wake_fds[0]);
+      close(wake_fds[1]);
+      return;
+    }
+    running = true;
+    publisher = std::thread([this](){ Publish(); });
+#endif
+  }
+
+  RowStream(const RowStream &) = delete;
+  RowStream & operator=(const RowStream &) = delete;
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To stop the publisher thread after it flushes the queue, and remove the socket.
+   */
+  ~RowStream() {
+#ifndef __EMSCRIPTEN__
+    if (listen_fd < 0) return;
+    running.store(false, std::memory_order_release);
+    Wake();
+    publisher.join();
+    close(listen_fd);
+    close(wake_fds[0]);
+    close(wake_fds[1]);
+    unlink(path.c_str());
+#endif
+    delete latest_raster.exchange(nullptr);
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: Whether the socket was created and the publisher is running.
+   *
+   * Purpose: To check whether the stream can be used.
+   */
+  bool IsOpen() const { return listen_fd >= 0; }
+
+  /**
+   * Input: None
+   *
+   * Output: The number of frames dropped so far, because the queue was full or a
+   * subscriber was not keeping up.
+   *
+   * Purpose: To report how lossy the stream has been.
+   */
+  size_t GetDropped() const { return dropped.load(std::memory_order_relaxed); }
+
+  /**
+   * Input: The frame's source (e.g. a data file name) and its payload.
+   *
+   * Output: Whether the frame was queued.
+   *
+   * Purpose: To publish a frame from the simulation thread. Never blocks.
+   */
+  bool Push(const std::string & source, const std::string & payload) {
+    return Enqueue(Frame{source, source + "\t" + payload, false});
+  }
+
+  /**
+   * Input: The raster's source and its payload.
+   *
+   * Output: None
+   *
+   * Purpose: To publish a raster from the simulation thread. Never blocks. Rasters
+   * are coalesced rather than queued: if the publisher has not sent the previous one
+   * yet, this one replaces it, so slow subscribers get the latest raster.
+   */
+  void PushRaster(const std::string & source, const std::string & payload) {
+    if (listen_fd < 0) return;
+    Frame * raster = new Frame{source, source + "\t" + payload, false};
+    delete latest_raster.exchange(raster, std::memory_order_acq_rel);
+#ifndef __EMSCRIPTEN__
+    Wake();
+#endif
+  }
+
+  /**
+   * Input: The frame's source and the header row it should be announced with.
+   *
+   * Output: None
+   *
+   * Purpose: To register a header that is sent once to every subscriber, whether it
+   * is already connected or connects later.
+   */
+  void SetHeader(const std::string & source, const std::string & header) {
+    std::string packet = source + "\t" + header;
+    {
+      std::lock_guard<std::mutex> lock(headers_mutex);
+      headers[source] = packet;
+    }
+    Enqueue(Frame{source, packet, true});
+  }
+};
+
+/**
+ * Input: A data file and the stream to publish it to.
+ *
+ * Output: None
+ *
+ * Purpose: To publish each row the file writes from now on (and its header) to the
+ * stream, whichever kind of capturing file it is, under the file's name.
+ */
+void StreamDataFile(CapturingDataFile & file, RowStream & stream) {
+  std::string source = file.GetFilename();
+  file.AddLineFun([&stream, source](const std::string & line, bool is_header){
+    if (is_header) stream.SetHeader(source, line);
+    else stream.Push(source, line);
+  });
+}
+
+/**
+  *
+  * Purpose: A DataFile that also publishes each row it writes (and its header) to a RowStream.
+  *
+*/
+class StreamedDataFile : public CapturingDataFile {
+public:
+  StreamedDataFile(const std::string & filename, RowStream & stream) : CapturingDataFile(filename) {
+    StreamDataFile(*this, stream);
+  }
+};
+
+/**
+  *
+  * Purpose: A reference subscriber for a RowStream, for notebooks' bridge scripts,
+  * the symbulation-subscribe tool, and tests.
+  *
+*/
+class RowSubscriber {
+private:
+  int fd = -1;
+
+public:
+  /**
+   * Input: The path of the stream's socket.
+   *
+   * Output: None
+   *
+   * Purpose: To connect to a running stream. IsOpen() reports whether this succeeded.
+   */
+  RowSubscriber(const std::string & path) {
+#ifndef __EMSCRIPTEN__
+    sockaddr_un addr = {};
+    if (path.size() >= sizeof(addr.sun_path)) return;
+    addr.sun_family = AF_UNIX;
+    path.copy(addr.sun_path, path.size());
+    fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (fd >= 0 && connect(fd, (sockaddr *) &addr, sizeof(addr)) != 0) {
+      close(fd);
+      fd = -1;
+    }
+#endif
+  }
+
+  RowSubscriber(const RowSubscriber &) = delete;
+  RowSubscriber & operator=(const RowSubscriber &) = delete;
+
+  ~RowSubscriber() {
+#ifndef __EMSCRIPTEN__
+    if (fd >= 0) close(fd);
+#endif
+  }
+
+  bool IsOpen() const { return fd >= 0; }
+
+  /**
+   * Input: Where to put the frame's source and payload, and how long to wait in
+   * milliseconds (-1 waits forever).
+   *
+   * Output: Whether a frame was received (false on timeout or when the stream closed).
+   *
+   * Purpose: To receive the next frame.
+   */
+  bool Receive(std::string & source, std::string & payload, int timeout_ms = -1) {
+#ifndef __EMSCRIPTEN__
+    if (fd < 0) return false;
+    pollfd sub_poll = {fd, POLLIN, 0};
+    if (poll(&sub_poll, 1, timeout_ms) <= 0) return false;
+    ssize_t size = recv(fd, nullptr, 0, MSG_PEEK | MSG_TRUNC);
+    if (size <= 0) return false;
+    std::string frame(size, '\0');
+    ssize_t received = recv(fd, &frame[0], frame.size(), 0);
+    if (received <= 0) return false;
+    frame.resize(received);
+    size_t tab = frame.find('\t');
+    source = frame.substr(0, tab);
+    payload = tab == std::string::npos ? "" : frame.substr(tab + 1);
+    return true;
+#else
+    return false;
+#endif
+  }
+};
+#endif
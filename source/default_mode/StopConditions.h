@@ -0,0 +1,133 @@
+#ifndef STOP_CONDITIONS_H
+#define STOP_CONDITIONS_H
+
+#include "../ConfigSetup.h"
+#include <chrono>
+#include <string>
+
+/**
+  *
+  * Purpose: Running counts, totals and totals of squares of host and symbiont
+  * (hosted and free-living) interaction values, added to organism by organism.
+  * Free-living symbionts are also counted on their own.
+  *
+*/
+struct PopulationTally {
+  size_t host_count = 0;
+  size_t sym_count = 0;
+  size_t free_sym_count = 0;
+  double host_intval_total = 0;
+  double host_intval_sq_total = 0;
+  double sym_intval_total = 0;
+  double sym_intval_sq_total = 0;
+
+  void AddHost(double int_val) {
+    host_count++;
+    host_intval_total += int_val;
+    host_intval_sq_total += int_val * int_val;
+  }
+
+  void AddSym(double int_val) {
+    sym_count++;
+    sym_intval_total += int_val;
+    sym_intval_sq_total += int_val * int_val;
+  }
+
+  void AddFreeSym(double int_val) {
+    free_sym_count++;
+    AddSym(int_val);
+  }
+
+  double GetHostVariance() const { return Variance(host_count, host_intval_total, host_intval_sq_total); }
+  double GetSymVariance() const { return Variance(sym_count, sym_intval_total, sym_intval_sq_total); }
+
+private:
+  static double Variance(size_t count, double total, double sq_total) {
+    if (count == 0) return 0;
+    double mean = total / count;
+    return std::max(0.0, sq_total / count - mean * mean);
+  }
+};
+
+/**
+  *
+  * Purpose: Why a run stopped early.
+  *
+*/
+enum class StopReason { NONE, HOST_EXTINCTION, SYM_EXTINCTION, LOW_VARIANCE, WALL_CLOCK };
+
+/**
+ * Input: A stop reason.
+ *
+ * Output: A description of it for the run's output.
+ *
+ * Purpose: To report why a run stopped.
+ */
+std::string DescribeStopReason(StopReason reason) {
+  switch (reason) {
+    case StopReason::HOST_EXTINCTION: return "hosts went extinct";
+    case StopReason::SYM_EXTINCTION: return "symbionts went extinct";
+    case StopReason::LOW_VARIANCE: return "interaction value variance fell below STOP_INTVAL_VARIANCE";
+    case StopReason::WALL_CLOCK: return "STOP_WALL_SECONDS ran out";
+    default: return "";
+  }
+}
+
+/**
+  *
+  * Purpose: The STOP_ settings, which end a run before UPDATES (and NO_MUT_UPDATES)
+  * when going on is pointless or out of time. The wall-clock budget counts from when
+  * the conditions were made.
+  *
+*/
+class StopConditions {
+private:
+  bool host_extinction;
+  bool sym_extinction;
+  double max_variance;
+  double wall_seconds;
+  size_t first_update;
+  std::chrono::steady_clock::time_point start;
+
+public:
+  StopConditions(SymConfigBase & config)
+    : host_extinction(config.STOP_HOST_EXTINCTION()), sym_extinction(config.STOP_SYM_EXTINCTION()),
+      max_variance(config.STOP_INTVAL_VARIANCE()), wall_seconds(config.STOP_WALL_SECONDS()),
+      first_update(std::max(config.STOP_CHECK_START(), 0)), start(std::chrono::steady_clock::now()) {}
+
+  /**
+   * Input: None
+   *
+   * Output: Whether any condition needs a population tally.
+   *
+   * Purpose: To let the world skip tallying when only the wall clock is checked.
+   */
+  bool UsesTally() const { return host_extinction || sym_extinction || max_variance >= 0; }
+
+  bool Any() const { return UsesTally() || wall_seconds > 0; }
+
+  /**
+   * Input: The update the world is at and the tally of its population.
+   *
+   * Output: The first condition that is met, or NONE.
+   *
+   * Purpose: To decide whether to stop. Only the wall clock is checked before
+   * STOP_CHECK_START, so that a population that starts out uniform is not taken for
+   * one that has stopped evolving.
+   */
+  StopReason Check(size_t update, const PopulationTally & tally) const {
+    if (update >= first_update) {
+      if (host_extinction && tally.host_count == 0) return StopReason::HOST_EXTINCTION;
+      if (sym_extinction && tally.sym_count == 0) return StopReason::SYM_EXTINCTION;
+      if (max_variance >= 0 && tally.GetHostVariance() <= max_variance && tally.GetSymVariance() <= max_variance) {
+        return StopReason::LOW_VARIANCE;
+      }
+    }
+    if (wall_seconds > 0) {
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      if (elapsed.count() >= wall_seconds) return StopReason::WALL_CLOCK;
+    }
+    return StopReason::NONE;
+  }
+};
+#endif
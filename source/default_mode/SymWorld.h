@@ -7,7 +7,24 @@
 #include "../../Empirical/include/emp/math/random_utils.hpp"
 #include "../../Empirical/include/emp/math/Random.hpp"
 #include "../Organism.h"
+#include "EventCounter.h"
+#include "MetricsPage.h"
+#include "RowStream.h"
+#include "ReplicateAggregator.h"
+#include "RollupDataFile.h"
+#include "Checkpoint.h"
+#include "JointHistogram.h"
+#include "PairStats.h"
+#include "WorldDigest.h"
+#include "StopConditions.h"
+#include "EventLog.h"
+#include "HostedSymTable.h"
 #include <set>
+#include <sstream>
+#include <map>
+#include <chrono>
+#include <cstdio>
+#include <algorithm>
 #include <math.h>
 
 
@@ -44,6 +61,33 @@ protected:
   */
   emp::Ptr<SymConfigBase> my_config = NULL;
 
+  /**
+    *
+    * Purpose: Represents whether nothing listens to host births, placements and deaths
+    * (no signal actions and no systematics), so they can skip Empirical's signals
+    * and hooks. Set by DetectEventListeners.
+    *
+  */
+  bool quiet_births = false;
+
+  /**
+    *
+    * Purpose: Represents whether a birth function was set with SetAddBirthFun. Such
+    * a function may need the offspring to place it, so hosts then make their
+    * offspring before placing it rather than after.
+    *
+  */
+  bool custom_birth_pos = false;
+
+  /**
+    *
+    * Purpose: Represents the organisms that have died (or been replaced) this update.
+    * They are out of the world already, and are destroyed together at the end of
+    * the update by ReclaimGraveyard.
+    *
+  */
+  emp::vector<emp::Ptr<Organism>> graveyard;
+
   /**
     *
     * Purpose: Represents the systematics object tracking hosts.
@@ -70,9 +114,117 @@ protected:
   emp::Ptr<emp::DataMonitor<int>> data_node_freesymcount;
   emp::Ptr<emp::DataMonitor<int>> data_node_hostedsymcount;
   emp::Ptr<emp::DataMonitor<int>> data_node_uninf_hosts;
-  emp::Ptr<emp::DataMonitor<int>> data_node_attempts_horiztrans;
-  emp::Ptr<emp::DataMonitor<int>> data_node_successes_horiztrans;
-  emp::Ptr<emp::DataMonitor<int>> data_node_attempts_verttrans;
+  emp::Ptr<EventCounter> data_node_attempts_horiztrans;
+  emp::Ptr<EventCounter> data_node_successes_horiztrans;
+  emp::Ptr<EventCounter> data_node_attempts_verttrans;
+  emp::Ptr<EventCounter> data_node_avoided_host_births;
+  emp::Ptr<EventCounter> data_node_avoided_sym_births;
+
+  /**
+    *
+    * Purpose: Represents the joint trait histograms, all filled by one traversal of the symbionts.
+    *
+  */
+  emp::vector<emp::Ptr<JointHistogram>> joint_histograms;
+  emp::vector<emp::Ptr<std::ofstream>> joint_histogram_files;
+  emp::vector<std::string> joint_histogram_filenames;
+
+  /**
+    *
+    * Purpose: Represents the host-symbiont pair statistics, filled by the host interaction
+    * value traversal, and which of them pairs interaction values.
+    *
+  */
+  emp::vector<emp::Ptr<PairStats>> pair_stats;
+  emp::Ptr<PairStats> data_node_intval_pairs;
+
+  /**
+    *
+    * Purpose: Represents the shared-memory page live metrics are published to each
+    * update, the snapshot published to it, the update and time throughput was last
+    * measured at, and the time memory use was last measured at.
+    *
+  */
+  emp::Ptr<MetricsPage> metrics_page;
+  MetricsSnapshot metrics;
+  size_t metrics_rate_update = 0;
+  std::chrono::steady_clock::time_point metrics_rate_time;
+  std::chrono::steady_clock::time_point metrics_rss_time;
+
+  /**
+    *
+    * Purpose: Represents the socket that data file rows (and rasters) are streamed to, if any.
+    *
+  */
+  emp::Ptr<RowStream> row_stream;
+  emp::Ptr<ReplicateAggregator> replicate_aggregator; // not owned; shared by the replicates run together
+
+  /**
+    *
+    * Purpose: Represents the data files that count the bytes they write for checkpoints,
+    * and, after resuming from a checkpoint, how many bytes of each output file the
+    * checkpointed run had written.
+    *
+  */
+  emp::vector<emp::Ptr<CheckpointDataFile>> checkpoint_files;
+  std::map<std::string, size_t> resume_lengths;
+
+  /**
+    *
+    * Purpose: Represents the rolling digest of the world's state (see WorldDigest),
+    * the update it was last taken at, and the file it is written to, every
+    * DIGEST_INT updates, by the host traversal.
+    *
+  */
+  uint64_t world_digest = 0;
+  size_t digest_update = 0;
+  emp::Ptr<emp::DataFile> digest_file;
+
+  /**
+    *
+    * Purpose: Represents the STOP_ conditions RunExperiment checks after each update,
+    * if any are set, and the tally of the population they and the metrics page are
+    * taken from, which Update adds each cell to as it is processed.
+    *
+  */
+  emp::Ptr<StopConditions> stop_conditions;
+  PopulationTally tally;
+  bool tally_population = false;
+
+  /**
+    *
+    * Purpose: Whether the world had no symbionts, hosted or free-living, at the end
+    * of the last update and none have been added since. While it is set, Update
+    * runs a host-only kernel that skips everything to do with symbionts.
+    *
+  */
+  bool host_only = false;
+
+  /**
+    *
+    * Purpose: Represents the number of symbionts belonging to this world that
+    * exist, hosted, free-living or waiting to be reclaimed. Kept by the
+    * symbionts themselves as they are made and destroyed.
+    *
+  */
+  size_t num_live_syms = 0;
+
+  /**
+    *
+    * Purpose: Represents the event log births, deaths, infections, lysis bursts and
+    * moves are written to, if EVENT_LOG is on (see EventLog).
+    *
+  */
+  emp::Ptr<EventLogWriter> event_log;
+
+  /**
+    *
+    * Purpose: Represents the contiguous table of hosted symbionts the data nodes scan
+    * (see HostedSymTable). It is made by the first data node that uses it, which
+    * also registers its rebuild ahead of every data node made after it.
+    *
+  */
+  emp::Ptr<HostedSymTable> hosted_sym_table;
 
 
 public:
@@ -109,8 +261,9 @@ public:
    * Output: None
    *
    * Purpose: To destruct the objects belonging to SymWorld to conserve memory.
+   * Virtual, since the mode worlds are run and deleted through SymWorld pointers.
    */
-  ~SymWorld() {
+  virtual ~SymWorld() {
     if (data_node_hostintval) data_node_hostintval.Delete();
     if (data_node_symintval) data_node_symintval.Delete();
     if (data_node_freesymintval) data_node_freesymintval.Delete();
@@ -124,14 +277,37 @@ public:
     if (data_node_hostedsymcount) data_node_hostedsymcount.Delete();
     if (data_node_uninf_hosts) data_node_uninf_hosts.Delete();
     if (data_node_attempts_horiztrans) data_node_attempts_horiztrans.Delete();
-    if (data_node_attempts_horiztrans) data_node_successes_horiztrans.Delete();
+    if (data_node_successes_horiztrans) data_node_successes_horiztrans.Delete();
     if (data_node_attempts_verttrans) data_node_attempts_verttrans.Delete();
+    if (data_node_avoided_host_births) data_node_avoided_host_births.Delete();
+    if (data_node_avoided_sym_births) data_node_avoided_sym_births.Delete();
+    for (emp::Ptr<JointHistogram> hist : joint_histograms) hist.Delete();
+    for (emp::Ptr<std::ofstream> file : joint_histogram_files) file.Delete();
+    for (emp::Ptr<PairStats> stats : pair_stats) stats.Delete();
+    if (hosted_sym_table) hosted_sym_table.Delete();
+    if (metrics_page) metrics_page.Delete();
+    if (row_stream) row_stream.Delete();
+    if (digest_file) digest_file.Delete();
+    if (stop_conditions) stop_conditions.Delete();
+    if (event_log) {
+      event_log.Delete();
+      event_log = nullptr; //the population below is cleared without being logged
+    }
 
     for(size_t i = 0; i < sym_pop.size(); i++){ //host population deletion is handled by empirical world destructor
       if(sym_pop[i]) {
         DoSymDeath(i);
       }
     }
+    for(size_t i = 0; i < pop.size(); i++){ //hosted symbionts go while the world can still count them
+      if(pop[i]) {
+        for (emp::Ptr<Organism> sym : pop[i]->GetSymbionts()) sym.Delete();
+        for (emp::Ptr<Organism> sym : pop[i]->GetReproSymbionts()) sym.Delete();
+        pop[i]->ClearSyms();
+        pop[i]->ClearReproSyms();
+      }
+    }
+    ReclaimGraveyard();
 
     if(my_config->PHYLOGENY()){ //host systematic deletion is handled by empirical world destructor
       sym_sys.Delete();
@@ -319,16 +495,35 @@ public:
       else Resize(pos.GetIndex() + 1);
     }
 
-    if(new_org->IsHost()){ //if the org is a host, use the empirical addorgat function
+    if(new_org->IsHost() && (new_org->HasSym() || !new_org->GetReproSymbionts().empty())) NoteSymbiontAdded();
+    if(event_log) {
+      if(new_org->IsHost()) {
+        event_log->HostPlaced(pos.GetIndex(), p_pos.IsValid() ? (int) p_pos.GetIndex() : -1, *new_org);
+        new_org->SetSymbiontsChanged(false);
+      } else {
+        event_log->FreeSymPlaced(pos.GetPopID(), p_pos.IsValid() ? (int) p_pos.GetPopID() : -1, *new_org);
+      }
+    }
+
+    if(new_org->IsHost() && quiet_births && pos.GetPopID() == 0){ //nothing to tell, so just place the host
+      size_t pos_id = pos.GetIndex();
+      if(!pop[pos_id]) {
+        ++num_orgs;
+      } else {
+        Bury(pop[pos_id]);
+      }
+      pop[pos_id] = new_org;
+    } else if(new_org->IsHost()){ //if the org is a host, use the empirical addorgat function
       emp::World<Organism>::AddOrgAt(new_org, pos, p_pos);
 
     } else { //if it is not a host, then add it to the sym population
+      NoteSymbiontAdded();
       //for symbionts, their place in their host's world is indicated by their ID
       size_t pos_id = pos.GetPopID();
       if(!sym_pop[pos_id]) {
         ++num_orgs;
       } else {
-        sym_pop[pos_id].Delete();
+        Bury(sym_pop[pos_id]);
       }
 
       //set the cell to point to the new sym
@@ -337,6 +532,101 @@ public:
   }
 
 
+  /**
+   * Input: The WorldPosition of the host that died.
+   *
+   * Output: None
+   *
+   * Purpose: To override the Empirical DoDeath function so that, when nothing
+   * listens to deaths, the host is removed without going through its signal and
+   * systematics hooks, and is destroyed with the rest of the update's dead. (When
+   * something listens, Empirical removes and destroys it at once.)
+   */
+  void DoDeath(emp::WorldPosition pos) {
+    if (event_log && pos.GetPopID() == 0 && IsOccupied(pos.GetIndex())) event_log->HostDied(pos.GetIndex());
+    if (!quiet_births || pos.GetPopID() != 0) {
+      emp::World<Organism>::DoDeath(pos);
+      return;
+    }
+    size_t pos_id = pos.GetIndex();
+    if (!pop[pos_id]) return;
+    Bury(pop[pos_id]);
+    pop[pos_id] = nullptr;
+    --num_orgs;
+  }
+
+
+  /**
+   * Input: The pointer to an organism that has been taken out of the world.
+   *
+   * Output: None
+   *
+   * Purpose: To have a dead organism destroyed at the end of the update, together
+   * with the update's other dead, instead of in the middle of it. A symbiont leaves
+   * the phylogeny right away, as it would if it were destroyed now.
+   */
+  void Bury(emp::Ptr<Organism> org) {
+    if (my_config->PHYLOGENY() && !org->IsHost() && org->GetTaxon()) {
+      sym_sys->RemoveOrg(org->GetTaxon(), GetUpdate());
+      org->SetTaxon(nullptr);
+    }
+    graveyard.push_back(org);
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of dead organisms waiting to be destroyed.
+   *
+   * Purpose: To check how many organisms have died since the graveyard was last reclaimed.
+   */
+  size_t GetGraveyardSize() const { return graveyard.size(); }
+
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To destroy the dead organisms in the graveyard (a host takes its
+   * symbionts with it). Called at the end of each update.
+   */
+  void ReclaimGraveyard() {
+    for (emp::Ptr<Organism> org : graveyard) org.Delete();
+    graveyard.clear();
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: Whether host births, placements and deaths skip Empirical's signals and
+   * systematics hooks.
+   *
+   * Purpose: To check which path births and deaths take.
+   */
+  bool HasQuietBirths() const { return quiet_births; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To check whether anything listens to host births, placements and
+   * deaths (signal actions or systematics), and if nothing does, to have them skip
+   * Empirical's signals and hooks from now on. Called by the world setups once the
+   * population structure is set; must be called again if listeners or systematics
+   * are added afterwards.
+   */
+  void DetectEventListeners() {
+    quiet_births = before_repro_sig.GetNumActions() == 0 && offspring_ready_sig.GetNumActions() == 0
+      && before_placement_sig.GetNumActions() == 0 && on_placement_sig.GetNumActions() == 0
+      && on_death_sig.GetNumActions() == 0 && systematics.size() == 0;
+  }
+
+
   //Overriding World's DoBirth to take a pointer instead of a reference
   //Because it takes a pointer, it doesn't support birthing multiple copies
   /**
@@ -349,10 +639,10 @@ public:
    */
   emp::WorldPosition DoBirth(emp::Ptr<Organism> new_org, emp::WorldPosition p_pos) {
     size_t parent_pos = p_pos.GetIndex();
-    before_repro_sig.Trigger(parent_pos);
+    if (!quiet_births) before_repro_sig.Trigger(parent_pos);
     emp::WorldPosition pos; // Position of each offspring placed.
 
-    offspring_ready_sig.Trigger(*new_org, parent_pos);
+    if (!quiet_births) offspring_ready_sig.Trigger(*new_org, parent_pos);
     pos = fun_find_birth_pos(new_org, parent_pos);
     if (pos.IsValid() && (pos.GetIndex() != parent_pos)) {
       //Add to the specified position, overwriting what may exist there
@@ -365,6 +655,88 @@ public:
   }
 
 
+  /**
+   * Input: The function that finds where an offspring is born, given the offspring
+   * and its parent's position.
+   *
+   * Output: None
+   *
+   * Purpose: To replace the birth function the population structure set. Hosts then
+   * make each offspring before it is placed, so the function can read it, and births
+   * follow Empirical's order of random draws.
+   */
+  void SetAddBirthFun(const fun_find_birth_pos_t & fun) {
+    fun_find_birth_pos = fun;
+    custom_birth_pos = true;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: Whether a birth function was set with SetAddBirthFun.
+   *
+   * Purpose: To check whether offspring can be placed before they are made.
+   */
+  bool HasCustomBirthPos() const { return custom_birth_pos; }
+
+
+  /**
+   * Input: The WorldPosition of the parent host.
+   *
+   * Output: None
+   *
+   * Purpose: To announce that a host is about to reproduce, before its offspring is
+   * made or placed.
+   */
+  void TriggerBeforeRepro(emp::WorldPosition p_pos) {
+    if (!quiet_births) before_repro_sig.Trigger(p_pos.GetIndex());
+  }
+
+
+  /**
+   * Input: The WorldPosition of the parent host.
+   *
+   * Output: Where the parent's offspring would be born, or an invalid WorldPosition
+   * if it would die at birth (e.g. it would land on its parent).
+   *
+   * Purpose: To place a host's offspring before it is made, so offspring that could
+   * not be placed are never made. The grid and well-mixed birth functions only use
+   * the parent's position; a custom birth function may need the offspring, so it
+   * cannot be used here (see HasCustomBirthPos).
+   */
+  emp::WorldPosition FindBirthPos(emp::WorldPosition p_pos) {
+    if (custom_birth_pos) throw "FindBirthPos cannot be used with a birth function set by SetAddBirthFun";
+    size_t parent_pos = p_pos.GetIndex();
+    emp::WorldPosition pos = fun_find_birth_pos(nullptr, parent_pos);
+    if (pos.IsValid() && (pos.GetIndex() != parent_pos)) return pos;
+    return emp::WorldPosition();
+  }
+
+
+  /**
+   * Input: (1) The pointer to the organism that is being birthed;
+   * (2) the position FindBirthPos found for it, or an invalid WorldPosition to have
+   * the birth function place it now; (3) the position of its parent.
+   *
+   * Output: None
+   *
+   * Purpose: To introduce a new host, overwriting what may exist where it is placed.
+   * An offspring the birth function places on its parent, or nowhere, is deleted.
+   */
+  void PlaceBirth(emp::Ptr<Organism> new_org, emp::WorldPosition pos, emp::WorldPosition p_pos) {
+    size_t parent_pos = p_pos.GetIndex();
+    if (!quiet_births) offspring_ready_sig.Trigger(*new_org, parent_pos);
+    if (!pos.IsValid()) {
+      pos = fun_find_birth_pos(new_org, parent_pos);
+      if (!pos.IsValid() || pos.GetIndex() == parent_pos) {
+        new_org.Delete();
+        return;
+      }
+    }
+    AddOrgAt(new_org, pos, parent_pos);
+  }
+
+
   /**
    * Input: The size_t value representing the location whose neighbors
    * are being searched.
@@ -393,6 +765,41 @@ public:
   }
 
 
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To be told that a symbiont has entered the world, so that the next
+   * update goes back to the full kernel.
+   */
+  void NoteSymbiontAdded() { host_only = false; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To count a symbiont of this world in or out as it is made or destroyed.
+   */
+  void NoteSymbiontMade() { num_live_syms++; }
+  void NoteSymbiontGone() { num_live_syms--; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of symbionts of this world that exist.
+   *
+   * Purpose: To get the world's count of live symbionts.
+   */
+  size_t GetNumLiveSymbionts() const { return num_live_syms; }
+
+
+  bool IsHostOnly() const { return host_only; }
+
+
   /**
    * Input: The pointer to an organism that will be injected into a host.
    *
@@ -423,6 +830,8 @@ public:
    * Definitions of data node functions, expanded in DataNodes.h
    */
   void CreateDateFiles();
+  void CreateReplayDataFiles();
+  void SetupJointHistograms(const std::string & filename);
   void WritePhylogenyFile(const std::string & filename);
   void WriteDominantPhylogenyFiles(const std::string & filename);
   emp::Ptr<emp::Taxon<int>> GetDominantSymTaxon();
@@ -436,11 +845,14 @@ public:
   emp::DataMonitor<int>& GetHostCountDataNode();
   emp::DataMonitor<int>& GetSymCountDataNode();
   emp::DataMonitor<int>& GetCountHostedSymsDataNode();
+  HostedSymTable & UseHostedSymTable();
   emp::DataMonitor<int>& GetCountFreeSymsDataNode();
   emp::DataMonitor<int>& GetUninfectedHostsDataNode();
-  emp::DataMonitor<int>& GetHorizontalTransmissionAttemptCount();
-  emp::DataMonitor<int>& GetHorizontalTransmissionSuccessCount();
-  emp::DataMonitor<int>& GetVerticalTransmissionAttemptCount();
+  EventCounter& GetHorizontalTransmissionAttemptCount();
+  EventCounter& GetHorizontalTransmissionSuccessCount();
+  EventCounter& GetVerticalTransmissionAttemptCount();
+  EventCounter& GetAvoidedHostBirthCount();
+  EventCounter& GetAvoidedSymBirthCount();
   emp::DataMonitor<double,emp::data::Histogram>& GetHostIntValDataNode();
   emp::DataMonitor<double,emp::data::Histogram>& GetSymIntValDataNode();
   emp::DataMonitor<double,emp::data::Histogram>& GetFreeSymIntValDataNode();
@@ -448,6 +860,15 @@ public:
   emp::DataMonitor<double,emp::data::Histogram>& GetSymInfectChanceDataNode();
   emp::DataMonitor<double,emp::data::Histogram>& GetFreeSymInfectChanceDataNode();
   emp::DataMonitor<double,emp::data::Histogram>& GetHostedSymInfectChanceDataNode();
+  SymTrait GetSymTrait(const std::string & name);
+  JointHistogram & AddJointHistogram(const std::string & x_trait, const std::string & y_trait, size_t bins);
+  emp::vector<emp::Ptr<JointHistogram>> & GetJointHistograms() {return joint_histograms;}
+  void SetupJointHistogramFile(const std::string & filename);
+  PairStats & AddPairStats(std::function<double(Organism &)> host_trait, std::function<double(Organism &)> sym_trait, double mismatch_min, double mismatch_max, size_t mismatch_bins);
+  PairStats & GetIntValPairDataNode();
+  emp::DataFile & SetupPairStatsFile(const std::string & filename);
+  emp::DataFile & SetupDigestFile(const std::string & filename);
+  uint64_t GetWorldDigest() const {return world_digest;}
 
   /**
    * Input: The pointer to the symbiont that is moving, the WorldPosition of its
@@ -506,25 +927,79 @@ public:
    * no eligible near-by hosts.
    */
    emp::WorldPosition SymDoBirth(emp::Ptr<Organism> sym_baby, emp::WorldPosition parent_pos) {
-    size_t i = parent_pos.GetPopID();
     if(my_config->FREE_LIVING_SYMS() == 0){
-      int new_host_pos = GetNeighborHost(i);
-      if (new_host_pos > -1) { //-1 means no living neighbors
-        int new_index = pop[new_host_pos]->AddSymbiont(sym_baby);
-        if(new_index > 0){ //sym successfully infected
-          return emp::WorldPosition(new_index, new_host_pos);
-        } else { //sym got killed trying to infect
-          return emp::WorldPosition();
-        }
-      } else {
+      emp::WorldPosition new_pos = FindSymBirthPos(parent_pos);
+      if (new_pos.IsValid()) { //sym successfully infected
+        if (event_log) event_log->HostedSymBorn(new_pos.GetPopID(), parent_pos.GetPopID(), *sym_baby);
+        PlaceSymBirth(sym_baby, new_pos);
+      } else { //no living neighbors, or sym got killed trying to infect
         sym_baby.Delete();
-        return emp::WorldPosition();
       }
+      return new_pos;
     } else {
       return MoveIntoNewFreeWorldPos(sym_baby, parent_pos);
     }
   }
 
+  /**
+   * Input: A function that makes the offspring, and the WorldPosition location of
+   * the parent symbiont.
+   *
+   * Output: The WorldPosition the offspring was born into, as for SymDoBirth.
+   *
+   * Purpose: To birth a new symbiont without making offspring that would die at
+   * birth. Without free-living symbionts, the neighboring host is picked and checked
+   * first, and the offspring is only made if it gets in; otherwise the avoided birth
+   * is counted. Free-living offspring can only die in an empty world, so they are
+   * made first and placed as by SymDoBirth.
+   */
+  template <typename MAKE_BABY>
+  emp::WorldPosition SymDoBirthIfPlaced(MAKE_BABY make_baby, emp::WorldPosition parent_pos) {
+    if(my_config->FREE_LIVING_SYMS() == 0){
+      emp::WorldPosition new_pos = FindSymBirthPos(parent_pos);
+      if (new_pos.IsValid()) {
+        emp::Ptr<Organism> sym_baby = make_baby();
+        if (event_log) event_log->HostedSymBorn(new_pos.GetPopID(), parent_pos.GetPopID(), *sym_baby);
+        PlaceSymBirth(sym_baby, new_pos);
+      } else {
+        GetAvoidedSymBirthCount().AddDatum(1);
+      }
+      return new_pos;
+    } else {
+      return MoveIntoNewFreeWorldPos(make_baby(), parent_pos);
+    }
+  }
+
+  /**
+   * Input: The WorldPosition location of the parent symbiont.
+   *
+   * Output: The WorldPosition a hosted offspring of the parent would be born into
+   * (as for SymDoBirth), or an invalid WorldPosition if it would die at birth.
+   *
+   * Purpose: To pick the neighboring host for a symbiont's offspring and check that it
+   * has room and lets the offspring in, before the offspring is made. The exclusion
+   * draw is made here, so it must be followed by PlaceSymBirth before anything else
+   * changes the chosen host's symbionts.
+   */
+  emp::WorldPosition FindSymBirthPos(emp::WorldPosition parent_pos) {
+    int new_host_pos = GetNeighborHost(parent_pos.GetPopID());
+    if (new_host_pos > -1 && pop[new_host_pos]->CanAddSymbiont()) { //-1 means no living neighbors
+      return emp::WorldPosition(pop[new_host_pos]->GetSymbionts().size() + 1, new_host_pos);
+    }
+    return emp::WorldPosition();
+  }
+
+  /**
+   * Input: The offspring and the position FindSymBirthPos found for it.
+   *
+   * Output: None
+   *
+   * Purpose: To put a new symbiont into the host FindSymBirthPos picked.
+   */
+  void PlaceSymBirth(emp::Ptr<Organism> sym_baby, emp::WorldPosition new_pos) {
+    pop[new_pos.GetPopID()]->AcceptSymbiont(sym_baby);
+  }
+
 
   /**
    * Input: The WorldPosition location of the symbiont to be moved.
@@ -538,11 +1013,15 @@ public:
     //the sym can either move into a parallel sym or to some random position
     if(IsOccupied(i) && sym_pop[i]->WantsToInfect()) {
       emp::Ptr<Organism> sym = ExtractSym(i);
+      bool got_in = false;
       if(sym->InfectionFails()) sym.Delete(); //if the sym tries to infect and fails it dies
-      else pop[i]->AddSymbiont(sym);
+      else got_in = pop[i]->AddSymbiont(sym) > 0;
+      if (event_log) event_log->Infection(i, got_in);
     }
     else if(my_config->MOVE_FREE_SYMS()) {
+      if (event_log) event_log->StartMove(i);
       MoveIntoNewFreeWorldPos(ExtractSym(i), pos);
+      if (event_log) event_log->EndMove();
     }
   }
 
@@ -589,7 +1068,8 @@ public:
    */
   void DoSymDeath(size_t i){
     if(sym_pop[i]){
-      sym_pop[i].Delete();
+      if (event_log) event_log->FreeSymDied(i);
+      Bury(sym_pop[i]);
       sym_pop[i] = nullptr;
       num_orgs--;
     }
@@ -616,22 +1096,755 @@ public:
     }
   }
 
+  /**
+   * Input: The name of the POSIX shared-memory segment to publish to (e.g. "/symbulation").
+   *
+   * Output: Whether the segment could be created.
+   *
+   * Purpose: To start publishing live metrics at the end of every update, for
+   * external monitors such as symbulation-top. The counts and means come from the
+   * population tally Update already makes, so publishing does not scan the world.
+   */
+  bool SetupMetricsPage(const std::string & name) {
+    if (metrics_page) metrics_page.Delete();
+    metrics_page = emp::NewPtr<MetricsPage>(name, true);
+    if (!metrics_page->IsOpen()) {
+      std::cerr << "Could not create shared-memory metrics page " << name
+                << " (another run may be using it, or a run that crashed left it behind)" << std::endl;
+      metrics_page.Delete();
+      metrics_page = nullptr;
+      return false;
+    }
+    tally_population = true;
+    metrics_rate_update = update;
+    metrics_rate_time = std::chrono::steady_clock::now();
+    metrics_rss_time = metrics_rate_time;
+    return true;
+  }
+
+  /**
+   * Input: The path of the Unix domain socket to stream to.
+   *
+   * Output: Whether the socket could be created.
+   *
+   * Purpose: To stream every data file set up after this call, row by row, to
+   * subscribers of the socket, alongside writing it to disk.
+   */
+  bool SetupRowStream(const std::string & path) {
+    if (row_stream) row_stream.Delete();
+    row_stream = emp::NewPtr<RowStream>(path);
+    if (!row_stream->IsOpen()) {
+      std::cerr << "Could not open data socket " << path << std::endl;
+      row_stream.Delete();
+      row_stream = nullptr;
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The stream data files are published to, or nullptr if there is none.
+   *
+   * Purpose: To access the row stream.
+   */
+  emp::Ptr<RowStream> GetRowStream() { return row_stream; }
+
+  /**
+   * Input: The aggregator shared by all replicates run alongside this world.
+   *
+   * Output: None
+   *
+   * Purpose: To report every data file set up after this call to the aggregator,
+   * which combines them across replicates. Whether this world also writes its own
+   * files is set by REPLICATE_FILES.
+   */
+  void SetReplicateAggregator(emp::Ptr<ReplicateAggregator> aggregator) { replicate_aggregator = aggregator; }
+
+  /**
+   * Input: The address of the string representing the file to be created's name
+   *
+   * Output: The address of the DataFile that has been created.
+   *
+   * Purpose: To create a data file that is updated with the world. Its rows are
+   * aggregated with the other replicates' files if the world is one of several
+   * replicates, or else rolled up if ROLLUP_LEVELS is set, or else, when
+   * checkpointing, written on from what the run had written before it was resumed.
+   * Whichever it is, the file is also streamed if the world has a row stream.
+   * CheckOutputSettings() rejects the combinations the files cannot support.
+   */
+  emp::DataFile & SetupFile(const std::string & filename) {
+    emp::Ptr<CapturingDataFile> file;
+    if (replicate_aggregator) {
+      if (my_config->REPLICATE_FILES()) file = emp::NewPtr<ReplicateDataFile>(filename, *replicate_aggregator);
+      else file = emp::NewPtr<ReplicateDataFile>(CapturingDataFile::GetNullStream(), filename, *replicate_aggregator);
+    } else if (my_config->ROLLUP_LEVELS() != "") {
+      file = emp::NewPtr<RollupDataFile>(filename, ParseRollupSpans(my_config->ROLLUP_LEVELS()), my_config->ROLLUP_RECENT());
+    } else if (my_config->CHECKPOINT_INT() > 0) {
+      std::string prefix;
+      if (resume_lengths.count(filename)) prefix = ReadFilePrefix(filename, resume_lengths[filename]);
+      emp::Ptr<CheckpointDataFile> checkpoint_file = emp::NewPtr<CheckpointDataFile>(filename, prefix);
+      checkpoint_files.push_back(checkpoint_file);
+      file = checkpoint_file;
+    } else if (row_stream) {
+      file = emp::NewPtr<CapturingDataFile>(filename);
+    } else {
+      return emp::World<Organism>::SetupFile(filename);
+    }
+    if (row_stream) StreamDataFile(*file, *row_stream);
+    files.push_back(file);
+    return *file;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To reject, before any data file is created, output settings whose data
+   * files would not do what they ask for: rollup windows are not saved in checkpoints,
+   * so a resumed run would start its rollups over, and files aggregated across
+   * replicates are not rolled up.
+   */
+  void CheckOutputSettings() {
+    if (my_config->ROLLUP_LEVELS() == "") return;
+    if (my_config->CHECKPOINT_INT() > 0) throw "ROLLUP_LEVELS cannot be combined with CHECKPOINT_INT";
+    if (replicate_aggregator) throw "ROLLUP_LEVELS cannot be combined with REPLICATES";
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To stream a raster frame of host interaction values, one comma-separated
+   * value per cell in world order (empty for unoccupied cells), tagged with the update.
+   */
+  void PublishRaster() {
+    std::stringstream raster;
+    raster << update;
+    for (size_t i = 0; i < pop.size(); i++) {
+      raster << ',';
+      if (IsOccupied(i)) raster << pop[i]->GetIntVal();
+    }
+    row_stream->PushRaster("raster_host_intval", raster.str());
+  }
+
+  /**
+   * Input: The snapshot to fill.
+   *
+   * Output: None
+   *
+   * Purpose: To fill in the metrics page: host, symbiont and free-living symbiont
+   * counts and mean interaction values, taken from the tally made while the update
+   * ran (so, like the stop conditions' tally, they can miss organisms born into
+   * cells already processed). Worlds with extra metrics (e.g. lytic bursts) extend this.
+   */
+  virtual void FillMetrics(MetricsSnapshot & snapshot) {
+    snapshot.update = update;
+    snapshot.host_count = tally.host_count;
+    snapshot.sym_count = tally.sym_count;
+    snapshot.free_sym_count = tally.free_sym_count;
+    snapshot.mean_host_intval = tally.host_intval_total / tally.host_count;
+    snapshot.mean_sym_intval = tally.sym_intval_total / tally.sym_count;
+    snapshot.avoided_host_births = GetAvoidedHostBirthCount().GetTotal();
+    snapshot.avoided_sym_births = GetAvoidedSymBirthCount().GetTotal();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To write the current metrics to the metrics page. Throughput is only
+   * re-measured about once a second, and memory about once every ten seconds.
+   */
+  void PublishMetrics() {
+    FillMetrics(metrics);
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - metrics_rate_time).count();
+    if (elapsed >= 1.0) {
+      metrics.updates_per_sec = (update - metrics_rate_update) / elapsed;
+      metrics_rate_update = update;
+      metrics_rate_time = now;
+    }
+    if (std::chrono::duration<double>(now - metrics_rss_time).count() >= 10.0) {
+      metrics.rss_bytes = GetResidentBytes();
+      metrics_rss_time = now;
+    }
+    metrics_page->Publish(metrics);
+  }
+
+  //recreate organisms from checkpoints; defined after the Host and Symbiont classes,
+  //and extended by worlds with their own organism classes
+  virtual emp::Ptr<Organism> MakeCheckpointHost(const std::string & name);
+  virtual emp::Ptr<Organism> MakeCheckpointSym(const std::string & name);
+
+  /**
+   * Input: The writer of the checkpoint being saved.
+   *
+   * Output: None
+   *
+   * Purpose: To save the world's state beyond its organisms: resources and the
+   * event counters behind the data files. Worlds with more state extend this.
+   */
+  virtual void WriteCheckpoint(CheckpointWriter & writer) {
+    writer.Write(total_res);
+    WriteCounter(writer, GetHorizontalTransmissionAttemptCount());
+    WriteCounter(writer, GetHorizontalTransmissionSuccessCount());
+    WriteCounter(writer, GetVerticalTransmissionAttemptCount());
+    WriteCounter(writer, GetAvoidedHostBirthCount());
+    WriteCounter(writer, GetAvoidedSymBirthCount());
+    writer.Write<uint64_t>(world_digest);
+  }
+
+  /**
+   * Input: The reader of the checkpoint being loaded.
+   *
+   * Output: None
+   *
+   * Purpose: To restore the state saved by WriteCheckpoint.
+   */
+  virtual void ReadCheckpoint(CheckpointReader & reader) {
+    total_res = reader.Read<int>();
+    ReadCounter(reader, GetHorizontalTransmissionAttemptCount());
+    ReadCounter(reader, GetHorizontalTransmissionSuccessCount());
+    ReadCounter(reader, GetVerticalTransmissionAttemptCount());
+    ReadCounter(reader, GetAvoidedHostBirthCount());
+    ReadCounter(reader, GetAvoidedSymBirthCount());
+    world_digest = reader.Read<uint64_t>();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To treat every event counted so far as already reported, so data files
+   * created now (e.g. a treatment's files after a shared burn-in) only count events
+   * from here on. Worlds with more counters extend this.
+   */
+  virtual void MarkEventsReported() {
+    GetHorizontalTransmissionAttemptCount().MarkReported();
+    GetHorizontalTransmissionSuccessCount().MarkReported();
+    GetVerticalTransmissionAttemptCount().MarkReported();
+  }
+
+  /**
+   * Input: The name of the checkpoint file to write.
+   *
+   * Output: None
+   *
+   * Purpose: To save everything needed to continue the run exactly as if it had not
+   * stopped: the update, every host (with its symbionts and reproductive symbionts)
+   * and free-living symbiont, the world state from WriteCheckpoint, how much of each
+   * output file has been written, and the random number generator. The file is
+   * written under a temporary name and then renamed, so a run killed while saving
+   * leaves the previous checkpoint intact. Systematics are not saved.
+   */
+  void SaveCheckpoint(const std::string & filename) {
+    std::string temp_filename = filename + ".tmp";
+    {
+      std::ofstream out(temp_filename, std::ios::binary);
+      CheckpointWriter writer(out);
+      writer.Write(CHECKPOINT_MAGIC);
+      writer.Write(CHECKPOINT_VERSION);
+      writer.Write<uint64_t>(update);
+
+      writer.Write<uint64_t>(pop.size());
+      for (size_t i = 0; i < pop.size(); i++) {
+        writer.Write<bool>(IsOccupied(i));
+        if (!IsOccupied(i)) continue;
+        writer.WriteString(pop[i]->GetName());
+        pop[i]->WriteState(writer);
+      }
+      writer.Write<uint64_t>(sym_pop.size());
+      for (size_t i = 0; i < sym_pop.size(); i++) {
+        writer.Write<bool>((bool) sym_pop[i]);
+        if (!sym_pop[i]) continue;
+        writer.WriteString(sym_pop[i]->GetName());
+        sym_pop[i]->WriteState(writer);
+      }
+
+      WriteCheckpoint(writer);
+
+      writer.Write<uint64_t>(checkpoint_files.size() + joint_histogram_files.size());
+      for (emp::Ptr<CheckpointDataFile> file : checkpoint_files) {
+        writer.WriteString(file->GetFilename());
+        writer.Write<uint64_t>(file->GetBytesWritten());
+      }
+      for (size_t i = 0; i < joint_histogram_files.size(); i++) {
+        writer.WriteString(joint_histogram_filenames[i]);
+        writer.Write<uint64_t>(joint_histogram_files[i]->tellp());
+      }
+
+      // the generator is copied as it is laid out in memory, so only the same build can read it back
+      static_assert(std::is_standard_layout<emp::Random>::value, "emp::Random must be plain data to be checkpointed");
+      writer.WriteBytes(&GetRandom(), sizeof(emp::Random));
+      out.flush();
+      if (!writer.Good()) throw "Could not write checkpoint file";
+    }
+    if (std::rename(temp_filename.c_str(), filename.c_str()) != 0) throw "Could not replace checkpoint file";
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To remove every host and free-living symbiont from the world.
+   */
+  void ClearPopulation() {
+    for (size_t i = 0; i < pop.size(); i++) {
+      if (IsOccupied(i)) RemoveOrgAt(i);
+    }
+    for (size_t i = 0; i < sym_pop.size(); i++) DoSymDeath(i);
+    ReclaimGraveyard();
+  }
+
+  /**
+   * Input: The reader of a checkpoint, positioned at its population.
+   *
+   * Output: None
+   *
+   * Purpose: To add the checkpoint's hosts and free-living symbionts to the (empty)
+   * world. With phylogeny tracking on, the read organisms start new lineages.
+   */
+  void ReadPopulation(CheckpointReader & reader) {
+    if (reader.Read<uint64_t>() != pop.size()) throw "Checkpoint was saved from a world of a different size";
+    for (size_t i = 0; i < pop.size(); i++) {
+      if (!reader.Read<bool>()) continue;
+      emp::Ptr<Organism> host = MakeCheckpointHost(reader.ReadString());
+      host->ReadState(reader);
+      AddOrgAt(host, emp::WorldPosition(i));
+      if (my_config->PHYLOGENY()) {
+        for (emp::Ptr<Organism> sym : host->GetSymbionts()) AddSymToSystematic(sym);
+        for (emp::Ptr<Organism> sym : host->GetReproSymbionts()) AddSymToSystematic(sym);
+      }
+    }
+    if (reader.Read<uint64_t>() != sym_pop.size()) throw "Checkpoint was saved from a world of a different size";
+    for (size_t i = 0; i < sym_pop.size(); i++) {
+      if (!reader.Read<bool>()) continue;
+      emp::Ptr<Organism> sym = MakeCheckpointSym(reader.ReadString());
+      sym->ReadState(reader);
+      AddOrgAt(sym, emp::WorldPosition(0, i));
+      if (my_config->PHYLOGENY()) AddSymToSystematic(sym);
+    }
+  }
+
+  /**
+   * Input: The name of a checkpoint file written by SaveCheckpoint.
+   *
+   * Output: None
+   *
+   * Purpose: To replace the world's population and state with the checkpoint's. The
+   * world must have been configured like the one that saved it (same mode, settings
+   * and world size). Data files set up afterwards continue the checkpointed run's
+   * files. With phylogeny tracking on, the restored organisms start new lineages.
+   */
+  void LoadCheckpoint(const std::string & filename) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in) throw "Could not open checkpoint file";
+    CheckpointReader reader(in);
+    ReadCheckpointHeader(reader);
+    size_t saved_update = reader.Read<uint64_t>();
+    ClearPopulation();
+    update = saved_update;
+    ReadPopulation(reader);
+    ReadCheckpoint(reader);
+
+    resume_lengths.clear();
+    size_t num_files = reader.Read<uint64_t>();
+    for (size_t i = 0; i < num_files; i++) {
+      std::string output_filename = reader.ReadString();
+      resume_lengths[output_filename] = reader.Read<uint64_t>();
+    }
+
+    reader.ReadBytes(&GetRandom(), sizeof(emp::Random));
+  }
+
+  /**
+   * Input: The name of a checkpoint file written by SaveCheckpoint.
+   *
+   * Output: None
+   *
+   * Purpose: To start a new run from the population of another run's checkpoint
+   * (e.g. an evolved community) without the rest of its state: the update, counters,
+   * data files and random number generator stay this world's own. The world must
+   * be the same mode and size as the one that saved it.
+   */
+  void LoadPopulation(const std::string & filename) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in) throw "Could not open population file";
+    CheckpointReader reader(in);
+    ReadCheckpointHeader(reader);
+    reader.Read<uint64_t>(); // the checkpoint's update
+    ClearPopulation();
+    ReadPopulation(reader);
+  }
+
+  /**
+   * Input: This world's island number, the number of islands, the chance each host
+   * and free-living symbiont has of leaving, and one outbox per island.
+   *
+   * Output: The number of organisms that left.
+   *
+   * Purpose: To send emigrants to the other islands of an island model. Each leaving
+   * host (with its symbionts) or free-living symbiont is written to the outbox of
+   * an island picked uniformly from the others, the way it would be written to a
+   * checkpoint, and taken out of this world.
+   */
+  size_t Emigrate(size_t island, size_t num_islands, double rate, emp::vector<std::string> & outboxes) {
+    if (num_islands < 2 || rate <= 0) return 0;
+    emp::vector<std::ostringstream> streams(num_islands);
+    size_t num_emigrants = 0;
+    auto send = [&](bool free_sym, emp::Ptr<Organism> org){
+      size_t destination = GetRandom().GetUInt(num_islands - 1);
+      if (destination >= island) destination++;
+      CheckpointWriter writer(streams[destination]);
+      writer.Write<bool>(free_sym);
+      writer.WriteString(org->GetName());
+      org->WriteState(writer);
+      num_emigrants++;
+    };
+    for (size_t i = 0; i < pop.size(); i++) {
+      if (IsOccupied(i) && GetRandom().P(rate)) {
+        send(false, pop[i]);
+        DoDeath(i);
+      }
+      if (sym_pop[i] && GetRandom().P(rate)) {
+        send(true, sym_pop[i]);
+        DoSymDeath(i);
+      }
+    }
+    ReclaimGraveyard();
+    for (size_t i = 0; i < num_islands; i++) outboxes[i] = streams[i].str();
+    return num_emigrants;
+  }
+
+  /**
+   * Input: Emigrants written by other islands' Emigrate.
+   *
+   * Output: The number of organisms that arrived.
+   *
+   * Purpose: To settle immigrants in random cells, each replacing whatever host or
+   * free-living symbiont was there. With phylogeny tracking on, immigrant
+   * symbionts start new lineages.
+   */
+  size_t Immigrate(const std::string & inbox) {
+    std::istringstream in(inbox);
+    CheckpointReader reader(in);
+    size_t num_immigrants = 0;
+    while (in.peek() != std::char_traits<char>::eof()) {
+      bool free_sym = reader.Read<bool>();
+      std::string name = reader.ReadString();
+      emp::Ptr<Organism> org = free_sym ? MakeCheckpointSym(name) : MakeCheckpointHost(name);
+      org->ReadState(reader);
+      size_t cell = GetRandom().GetUInt(pop.size());
+      if (free_sym) {
+        AddOrgAt(org, emp::WorldPosition(0, cell));
+        if (my_config->PHYLOGENY()) AddSymToSystematic(org);
+      } else {
+        AddOrgAt(org, emp::WorldPosition(cell));
+        if (my_config->PHYLOGENY()) {
+          for (emp::Ptr<Organism> sym : org->GetSymbionts()) AddSymToSystematic(sym);
+          for (emp::Ptr<Organism> sym : org->GetReproSymbionts()) AddSymToSystematic(sym);
+        }
+      }
+      num_immigrants++;
+    }
+    ReclaimGraveyard();
+    return num_immigrants;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The name of the event log: EventLog<FILE_NAME>_SEED<seed>.bin in FILE_PATH.
+   *
+   * Purpose: To name the event log EVENT_LOG writes.
+   */
+  std::string GetEventLogFilename() {
+    return my_config->FILE_PATH()+"EventLog"+my_config->FILE_NAME()+"_SEED"+std::to_string(my_config->SEED())+".bin";
+  }
+
+  /**
+   * Input: The name of the event log to write.
+   *
+   * Output: None
+   *
+   * Purpose: To start logging events, beginning with every organism already in the
+   * world as if it had just been placed. A run resumed from a checkpoint starts a
+   * new log from the checkpoint's population.
+   */
+  void StartEventLog(const std::string & filename) {
+    if (event_log) event_log.Delete();
+    event_log = emp::NewPtr<EventLogWriter>(filename, my_config->SEED(), GetSize(), update);
+    for (size_t i = 0; i < GetSize(); i++) {
+      if (IsOccupied(i)) {
+        event_log->HostPlaced(i, -1, *pop[i]);
+        pop[i]->SetSymbiontsChanged(false);
+      }
+      if (sym_pop[i]) event_log->FreeSymPlaced(i, -1, *sym_pop[i]);
+    }
+  }
+
+  emp::Ptr<EventLogWriter> GetEventLog() {return event_log;}
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To write out the event log so far, including hosted symbiont changes
+   * not yet swept, so that it can be replayed up to this point.
+   */
+  void FlushEventLog() {
+    if (!event_log) return;
+    LogHostSymbionts();
+    event_log->Flush();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To log the symbionts of every host whose symbionts changed since they
+   * were last logged. Hosted symbionts are logged this way, once per update, because
+   * hosts do not know which cell they are in.
+   */
+  void LogHostSymbionts() {
+    for (size_t i = 0; i < pop.size(); i++) {
+      if (pop[i] && pop[i]->GetSymbiontsChanged()) {
+        event_log->HostSymbionts(i, *pop[i]);
+        pop[i]->SetSymbiontsChanged(false);
+      }
+    }
+  }
+
+  /**
+   * Input: A reader of an event log, the interval between the updates whose data
+   * rows are written (e.g. DATA_INT; other updates skip the data nodes' traversals),
+   * and, optionally, a function to call with each event as it is replayed.
+   *
+   * Output: The number of events replayed.
+   *
+   * Purpose: To rebuild a logged run's population, event by event, and write the
+   * world's data files from it at each logged update as the run itself would have,
+   * without simulating it. The world should be empty and configured like the logged
+   * run (data files and DATA_INT may differ). Replayed organisms have only their
+   * logged traits (interaction value and, for symbionts, infection chance), so only
+   * data computed from those, and from where organisms are, matches the run.
+   */
+  size_t ReplayEventLog(EventLogReader & reader, size_t row_interval = 1, std::function<void(const LoggedEvent &)> on_event = nullptr) {
+    if (GetSize() < reader.GetNumCells()) Resize(reader.GetNumCells());
+    update = reader.GetStartUpdate();
+    auto make_sym = [this](const LoggedSym & traits){
+      emp::Ptr<Organism> sym = MakeCheckpointSym("Symbiont");
+      sym->SetIntVal(traits.int_val);
+      sym->SetInfectionChance(traits.infection_chance);
+      return sym;
+    };
+    auto make_host = [this, &make_sym](double int_val, const emp::vector<LoggedSym> & logged_syms){
+      emp::Ptr<Organism> host = MakeCheckpointHost("Host");
+      host->SetIntVal(int_val);
+      for (const LoggedSym & traits : logged_syms) {
+        emp::Ptr<Organism> sym = make_sym(traits);
+        host->GetSymbionts().push_back(sym);
+        sym->SetHost(host);
+      }
+      return host;
+    };
+
+    LoggedEvent event;
+    size_t num_events = 0;
+    while (reader.Next(event)) {
+      switch (event.kind) {
+        case LogEvent::UPDATE:
+          ReclaimGraveyard();
+          update = event.cell;
+          if (update % row_interval == 0) emp::World<Organism>::Update();
+          else update++;
+          break;
+        case LogEvent::FINAL_ROW:
+          update = event.cell;
+          WriteFinalDataRow();
+          break;
+        case LogEvent::HOST_PLACED:
+          AddOrgAt(make_host(event.traits.int_val, event.syms), emp::WorldPosition(event.cell));
+          break;
+        case LogEvent::HOST_DIED:
+          DoDeath(event.cell);
+          break;
+        case LogEvent::HOST_SYMBIONTS: {
+          if (!IsOccupied(event.cell)) throw "Event log changes the symbionts of a missing host";
+          //reuse the host's symbionts rather than remaking them
+          emp::vector<emp::Ptr<Organism>> & syms = pop[event.cell]->GetSymbionts();
+          for (size_t j = event.syms.size(); j < syms.size(); j++) Bury(syms[j]);
+          if (syms.size() > event.syms.size()) syms.resize(event.syms.size());
+          for (size_t j = 0; j < event.syms.size(); j++) {
+            if (j < syms.size()) {
+              syms[j]->SetIntVal(event.syms[j].int_val);
+              syms[j]->SetInfectionChance(event.syms[j].infection_chance);
+            } else {
+              syms.push_back(make_sym(event.syms[j]));
+              syms[j]->SetHost(pop[event.cell]);
+            }
+          }
+          break;
+        }
+        case LogEvent::FREE_SYM_PLACED:
+          AddOrgAt(make_sym(event.traits), emp::WorldPosition(0, event.cell));
+          break;
+        case LogEvent::FREE_SYM_DIED:
+        case LogEvent::INFECTION:
+          DoSymDeath(event.cell);
+          break;
+        case LogEvent::FREE_SYM_MOVED: {
+          emp::Ptr<Organism> sym = ExtractSym(event.cell);
+          if (!sym) throw "Event log moves a missing free-living symbiont";
+          AddOrgAt(sym, emp::WorldPosition(0, event.other));
+          break;
+        }
+        default: //births into hosts show up in HOST_SYMBIONTS; bursts leave dead hosts
+          break;
+      }
+      if (on_event) on_event(event);
+      num_events++;
+    }
+    ReclaimGraveyard();
+    return num_events;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The name of the checkpoint file: CHECKPOINT_FILE, or by default
+   * Checkpoint<FILE_NAME>_SEED<seed>.bin in FILE_PATH.
+   *
+   * Purpose: To name the checkpoint file periodic checkpoints are saved to.
+   */
+  std::string GetCheckpointFilename() {
+    if (my_config->CHECKPOINT_FILE() != "") return my_config->CHECKPOINT_FILE();
+    return my_config->FILE_PATH()+"Checkpoint"+my_config->FILE_NAME()+"_SEED"+std::to_string(my_config->SEED())+".bin";
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: Whether the world was resumed from a checkpoint.
+   *
+   * Purpose: When checkpointing is on and the checkpoint file exists (e.g. the job
+   * was preempted), to resume from it. Called after the world is set up and before
+   * its data files are created.
+   */
+  bool ResumeFromCheckpoint() {
+    if (my_config->CHECKPOINT_INT() <= 0) return false;
+    std::string filename = GetCheckpointFilename();
+    if (!std::ifstream(filename).good()) return false;
+    LoadCheckpoint(filename);
+    std::cout << "Resuming from " << filename << " at update " << update << std::endl;
+    return true;
+  }
+
+  /**
+   * Input: The index of a cell that has just been processed.
+   *
+   * Output: None
+   *
+   * Purpose: To add the cell's host, its symbionts and its free-living symbiont
+   * to the tally the stop conditions and the metrics page are taken from.
+   */
+  void TallyCell(size_t i) {
+    if (IsOccupied(i)) {
+      tally.AddHost(pop[i]->GetIntVal());
+      emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
+      for (size_t j = 0; j < syms.size(); j++) tally.AddSym(syms[j]->GetIntVal());
+    }
+    if (i < sym_pop.size() && sym_pop[i] && !sym_pop[i]->GetDead()) tally.AddFreeSym(sym_pop[i]->GetIntVal());
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: Whether a stop condition is met.
+   *
+   * Purpose: To check the stop conditions after an update. The tally is made while
+   * the update runs, so organisms born into cells that were already processed are
+   * missed; if it meets a population condition, the population is counted again
+   * exactly before the run is stopped.
+   */
+  StopReason CheckStopConditions() {
+    if (!stop_conditions) return StopReason::NONE;
+    StopReason reason = stop_conditions->Check(update, tally);
+    if (reason == StopReason::NONE || reason == StopReason::WALL_CLOCK) return reason;
+    tally = PopulationTally();
+    for (size_t i = 0; i < pop.size(); i++) TallyCell(i);
+    return stop_conditions->Check(update, tally);
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To write a row for the current update to every data file, whatever
+   * their timing, when a run stops early. Like an update, this refreshes the data
+   * nodes and then moves the update counter on, but no organism is processed.
+   */
+  void WriteFinalDataRow() {
+    if (event_log) {
+      LogHostSymbionts();
+      event_log->FinalRow(update);
+    }
+    for (emp::Ptr<emp::DataFile> file : files) file->SetTimingOnce(update);
+    emp::World<Organism>::Update();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: Whether the run should stop now.
+   *
+   * Purpose: To end a run early once a stop condition is met: the final data row is
+   * written, and if the wall clock ran out and checkpoints are on, a checkpoint is
+   * saved first so the run can be resumed later.
+   */
+  bool StopEarly() {
+    StopReason reason = CheckStopConditions();
+    if (reason == StopReason::NONE) return false;
+    std::cout << "Stopping at update " << update << ": " << DescribeStopReason(reason) << std::endl;
+    if (reason == StopReason::WALL_CLOCK && my_config->CHECKPOINT_INT() > 0) SaveCheckpoint(GetCheckpointFilename());
+    WriteFinalDataRow();
+    return true;
+  }
+
   /**
    * Input: Optional boolean "verbose" that specifies whether to print the update numbers to standard output or not, defaults to true.
    *
    * Output: None
    *
-   * Purpose: Run the number of updates and non-mutation updates specified in the configuration settings.
+   * Purpose: Run the number of updates and non-mutation updates specified in the configuration settings,
+   * or until one of the STOP_ conditions is met.
    */
   void RunExperiment(bool verbose=true) {
+    StartRun();
+
     //Loop through updates
+    //a run resumed from a checkpoint starts from the checkpoint's update
     int numupdates = my_config->UPDATES();
-    for (int i = 0; i < numupdates; i++) {
+    for (int i = GetUpdate(); i < numupdates; i++) {
       if(verbose && (i%my_config->DATA_INT())==0) {
         std::cout <<"Update: "<< i << std::endl;
         std::cout.flush();
       }
       Update();
+      if (stop_conditions && StopEarly()) {
+        FlushEventLog();
+        return;
+      }
     }
 
     int num_no_mut_updates = my_config->NO_MUT_UPDATES();
@@ -639,13 +1852,36 @@ public:
       SetMutationZero();
     }
 
-    for (int i = 0; i < num_no_mut_updates; i++) {
+    for (int i = std::max(0, (int) GetUpdate() - numupdates); i < num_no_mut_updates; i++) {
       if(verbose && (i%my_config->DATA_INT())==0) {
         std::cout <<"No mutation update: "<< i << std::endl;
         std::cout.flush();
       }
       Update();
+      if (stop_conditions && StopEarly()) {
+        FlushEventLog();
+        return;
+      }
     }
+    FlushEventLog();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To get the world ready to run its updates: set up the STOP_ conditions,
+   * the population tally they and the metrics page read, and the event log. Runs
+   * that drive Update themselves (e.g. islands) call this first and FlushEventLog
+   * when they are done, as RunExperiment does.
+   */
+  void StartRun() {
+    if (stop_conditions) stop_conditions.Delete();
+    StopConditions conditions(*my_config);
+    if (conditions.Any()) stop_conditions = emp::NewPtr<StopConditions>(conditions);
+    tally_population = (stop_conditions && stop_conditions->UsesTally()) || metrics_page;
+    if (my_config->EVENT_LOG() && !event_log) StartEventLog(GetEventLogFilename());
   }
 
 
@@ -657,6 +1893,10 @@ public:
    * Purpose: To simulate a timestep in the world, which includes calling the process functions for hosts and symbionts and updating the data nodes.
    */
   void Update() {
+    if (event_log) {
+      LogHostSymbionts();
+      event_log->Update(update);
+    }
     emp::World<Organism>::Update();
 
     // Handle resource inflow
@@ -666,21 +1906,39 @@ public:
 
     if(my_config->PHYLOGENY()) sym_sys->Update(); //sym_sys is not part of the systematics vector, handle it independently
     emp::vector<size_t> schedule = emp::GetPermutation(GetRandom(), GetSize());
-    // divvy up and distribute resources to host and symbiont in each cell
-    for (size_t i : schedule) {
-      if (IsOccupied(i) == false && !sym_pop[i]){ continue;} // no organism at that cell
-      if(IsOccupied(i)){//can't call GetDead on a deleted sym, so
-        pop[i]->Process(i);
-        if (pop[i]->GetDead()) { //Check if the host died
-          DoDeath(i);
-        }
-      }
-      if(sym_pop[i]){ //for sym movement reasons, syms are deleted the update after they are set to dead
-        emp::WorldPosition sym_pos = emp::WorldPosition(0,i);
-        if (sym_pop[i]->GetDead()) DoSymDeath(i); //Might have died since their last time being processed
-        else sym_pop[i]->Process(sym_pos); //index 0, since it's freeliving, and id its location in the world
+    if (tally_population) tally = PopulationTally();
+    if (host_only) {
+      // no symbionts anywhere, so hosts only gather resources, reproduce and age
+      for (size_t i : schedule) {
+        if (!IsOccupied(i)) continue;
+        pop[i]->ProcessWithoutSymbionts(i);
+        if (pop[i]->GetDead()) DoDeath(i);
+        if (tally_population) TallyCell(i);
       }
-    } // for each cell in schedule
+    } else {
+      // divvy up and distribute resources to host and symbiont in each cell
+      for (size_t i : schedule) {
+        if (IsOccupied(i) == false && !sym_pop[i]){ continue;} // no organism at that cell
+        if(IsOccupied(i)){//can't call GetDead on a deleted sym, so
+          pop[i]->Process(i);
+          if (pop[i]->GetDead()) { //Check if the host died
+            DoDeath(i);
+          }
+        }
+        if(sym_pop[i]){ //for sym movement reasons, syms are deleted the update after they are set to dead
+          emp::WorldPosition sym_pos = emp::WorldPosition(0,i);
+          if (sym_pop[i]->GetDead()) DoSymDeath(i); //Might have died since their last time being processed
+          else sym_pop[i]->Process(sym_pos); //index 0, since it's freeliving, and id its location in the world
+        }
+        if (tally_population) TallyCell(i);
+      } // for each cell in schedule
+    }
+    ReclaimGraveyard();
+    host_only = num_live_syms == 0;
+
+    if (metrics_page) PublishMetrics();
+    if (row_stream && my_config->DATA_SOCKET_RASTER() && update % my_config->DATA_INT() == 0) PublishRaster();
+    if (my_config->CHECKPOINT_INT() > 0 && update % my_config->CHECKPOINT_INT() == 0) SaveCheckpoint(GetCheckpointFilename());
   } // Update()
 };// SymWorld class
 #endif
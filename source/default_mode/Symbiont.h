@@ -8,6 +8,30 @@
 #include <iomanip> // setprecision
 #include <sstream> // stringstream
 
+/**
+ * Purpose: Represents a symbiont's place in its world's count of live symbionts.
+ * It is counted from when it is made until it is destroyed, whether it was
+ * constructed, copied or moved, so the count never misses a way in or out.
+ */
+class LiveSymbiont {
+  emp::Ptr<SymWorld> world = nullptr;
+
+public:
+  LiveSymbiont(emp::Ptr<SymWorld> _world = nullptr) : world(_world) {
+    if (world) world->NoteSymbiontMade();
+  }
+  LiveSymbiont(const LiveSymbiont & other) : LiveSymbiont(other.world) {}
+  LiveSymbiont & operator=(const LiveSymbiont & other) {
+    if (other.world) other.world->NoteSymbiontMade();
+    if (world) world->NoteSymbiontGone();
+    world = other.world;
+    return *this;
+  }
+  ~LiveSymbiont() {
+    if (world) world->NoteSymbiontGone();
+  }
+};
+
 
 class Symbiont: public Organism {
 protected:
@@ -66,6 +90,13 @@ protected:
   */
   emp::Ptr<SymWorld> my_world = NULL;
 
+  /**
+    *
+    * Purpose: Represents this symbiont in its world's count of live symbionts.
+    *
+  */
+  LiveSymbiont live;
+
   /**
     *
     * Purpose: Represents the symbiont's host.
@@ -91,7 +122,7 @@ public:
   /**
    * The constructor for symbiont
    */
-  Symbiont(emp::Ptr<emp::Random> _random, emp::Ptr<SymWorld> _world, emp::Ptr<SymConfigBase> _config, double _intval=0.0, double _points = 0.0) :  interaction_val(_intval), points(_points), random(_random), my_world(_world), my_config(_config) {
+  Symbiont(emp::Ptr<emp::Random> _random, emp::Ptr<SymWorld> _world, emp::Ptr<SymConfigBase> _config, double _intval=0.0, double _points = 0.0) :  interaction_val(_intval), points(_points), random(_random), my_world(_world), live(_world), my_config(_config) {
     infection_chance = my_config->SYM_INFECTION_CHANCE();
     if (infection_chance == -2) infection_chance = random->GetDouble(0,1); //randomized starting infection chance
     if (infection_chance > 1 || infection_chance < 0) throw "Invalid infection chance. Must be between 0 and 1"; //exception for invalid infection chance
@@ -159,7 +190,7 @@ public:
    * Purpose: To destruct the symbiont and remove the symbiont from the systematic.
    */
   ~Symbiont() {
-    if(my_config->PHYLOGENY() == 1) {my_world->GetSymSys()->RemoveOrg(my_taxon, my_world->GetUpdate());}
+    if(my_config->PHYLOGENY() == 1 && my_taxon) {my_world->GetSymSys()->RemoveOrg(my_taxon, my_world->GetUpdate());}
   }
 
     /**
@@ -173,6 +204,37 @@ public:
       return  "Symbiont";
     }
 
+    /**
+    * Input: The writer of the checkpoint being saved.
+    *
+    * Output: None
+    *
+    * Purpose: To save the symbiont's state to a checkpoint. Its host and taxon are
+    * restored by whoever holds it.
+    */
+    void WriteState(CheckpointWriter & writer) {
+      writer.Write(interaction_val);
+      writer.Write(points);
+      writer.Write(dead);
+      writer.Write(infection_chance);
+      writer.Write(age);
+    }
+
+    /**
+    * Input: The reader of the checkpoint being loaded.
+    *
+    * Output: None
+    *
+    * Purpose: To restore the symbiont's state saved by WriteState.
+    */
+    void ReadState(CheckpointReader & reader) {
+      interaction_val = reader.Read<double>();
+      points = reader.Read<double>();
+      dead = reader.Read<bool>();
+      infection_chance = reader.Read<double>();
+      age = reader.Read<int>();
+    }
+
 
   /**
    * Input: None
@@ -339,6 +401,16 @@ public:
    */
   void SetHost(emp::Ptr<Organism> _in) {my_host = _in;}
 
+  /**
+   * Input: The random number generator the symbiont should draw from
+   *
+   * Output: None
+   *
+   * Purpose: To move a symbiont built with a temporary generator (e.g. by the bulk
+   * setup) over to the world's.
+   */
+  void SetRandom(emp::Ptr<emp::Random> _in) {random = _in;}
+
   /**
    * Input: The double that will be the symbiont's infection chance
    *
@@ -564,7 +636,7 @@ public:
       host_baby->AddSymbiont(sym_baby);
 
       //vertical transmission data node
-      emp::DataMonitor<int>& data_node_attempts_verttrans = my_world->GetVerticalTransmissionAttemptCount();
+      EventCounter& data_node_attempts_verttrans = my_world->GetVerticalTransmissionAttemptCount();
       data_node_attempts_verttrans.AddDatum(1);
     }
   }
@@ -583,14 +655,14 @@ public:
         //TODO: try just subtracting points to be consistent with vertical transmission
         //points = points - my_config->SYM_HORIZ_TRANS_RES();
         SetPoints(0);
-        emp::Ptr<Organism> sym_baby = Reproduce();
-        emp::WorldPosition new_pos = my_world->SymDoBirth(sym_baby, location);
+        //the offspring is only made if it has somewhere to go
+        emp::WorldPosition new_pos = my_world->SymDoBirthIfPlaced([this](){ return Reproduce(); }, location);
 
         //horizontal transmission data nodes
-        emp::DataMonitor<int>& data_node_attempts_horiztrans = my_world->GetHorizontalTransmissionAttemptCount();
+        EventCounter& data_node_attempts_horiztrans = my_world->GetHorizontalTransmissionAttemptCount();
         data_node_attempts_horiztrans.AddDatum(1);
 
-        emp::DataMonitor<int>& data_node_successes_horiztrans = my_world->GetHorizontalTransmissionSuccessCount();
+        EventCounter& data_node_successes_horiztrans = my_world->GetHorizontalTransmissionSuccessCount();
         if(new_pos.IsValid()){
           data_node_successes_horiztrans.AddDatum(1);
         }
@@ -598,4 +670,17 @@ public:
     }
   }
 };
+
+/**
+ * Input: The class name of a symbiont saved in a checkpoint.
+ *
+ * Output: A new symbiont of that class, whose state is then read from the checkpoint.
+ *
+ * Purpose: To recreate symbionts when loading a checkpoint.
+ */
+emp::Ptr<Organism> SymWorld::MakeCheckpointSym(const std::string & name) {
+  if (name == "Symbiont") return emp::NewPtr<Symbiont>(&GetRandom(), this, my_config);
+  throw "Checkpoint contains a symbiont this world cannot make";
+}
+
 #endif
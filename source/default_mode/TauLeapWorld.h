@@ -0,0 +1,542 @@
+#ifndef TAU_LEAP_WORLD_H
+#define TAU_LEAP_WORLD_H
+
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../../Empirical/include/emp/data/DataFile.hpp"
+#include "../../Empirical/include/emp/math/Random.hpp"
+#include "../ConfigSetup.h"
+#include "TraitBins.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <utility>
+
+/**
+ * Input: The random number generator, the number of trials and the chance of success.
+ *
+ * Output: The number of successes.
+ *
+ * Purpose: To draw from a binomial distribution in time that does not grow with the
+ * number of trials: exactly, by skipping from success to success, when few successes
+ * are expected, and with the normal approximation otherwise.
+ */
+size_t DrawBinomial(emp::Random & random, size_t n, double p) {
+  if (n == 0 || p <= 0) return 0;
+  if (p >= 1) return n;
+  if (p > 0.5) return n - DrawBinomial(random, n, 1 - p);
+  double mean = n * p;
+  if (mean < 30) {
+    double log_q = std::log(1 - p);
+    size_t count = 0;
+    double trial = 0;
+    while (true) {
+      trial += std::floor(std::log(1 - random.GetDouble()) / log_q) + 1;
+      if (trial > n) return count;
+      count++;
+    }
+  }
+  double draw = std::round(mean + std::sqrt(mean * (1 - p)) * random.GetRandNormal(0, 1));
+  return (size_t) std::min((double) n, std::max(0.0, draw));
+}
+
+/**
+ * Input: The random number generator, the number of draws, the weight of each outcome,
+ * and where to put the number of draws of each outcome.
+ *
+ * Output: None
+ *
+ * Purpose: To draw from a multinomial distribution, one outcome at a time.
+ */
+void DrawMultinomial(emp::Random & random, size_t n, const emp::vector<double> & weights, emp::vector<size_t> & counts) {
+  counts.assign(weights.size(), 0);
+  double remaining = 0;
+  for (double weight : weights) remaining += weight;
+  for (size_t i = 0; i < weights.size() && n > 0; i++) {
+    if (weights[i] <= 0) continue;
+    double p = weights[i] / remaining;
+    counts[i] = p >= 1 ? n : DrawBinomial(random, n, p);
+    n -= counts[i];
+    remaining -= weights[i];
+  }
+}
+
+/**
+ * Input: The random number generator, the number of individuals of each kind, and how
+ * many individuals to take.
+ *
+ * Output: The number taken of each kind, which are also taken off the counts.
+ *
+ * Purpose: To remove individuals picked at random (approximately, without
+ * replacement). Exactly n are removed, or all of them if there are fewer.
+ */
+emp::vector<size_t> DrawWithoutReplacement(emp::Random & random, emp::vector<size_t> & counts, size_t n) {
+  emp::vector<size_t> taken(counts.size(), 0);
+  size_t remaining = 0;
+  for (size_t count : counts) remaining += count;
+  n = std::min(n, remaining);
+  for (size_t i = 0; i < counts.size() && n > 0; i++) {
+    if (counts[i] == 0) continue;
+    size_t after = remaining - counts[i];
+    size_t draw = DrawBinomial(random, n, (double) counts[i] / remaining);
+    // never take more than there are, or leave more to take than the rest can give
+    draw = std::max(std::min(draw, counts[i]), n > after ? n - after : 0);
+    taken[i] = draw;
+    counts[i] -= draw;
+    n -= draw;
+    remaining = after;
+  }
+  return taken;
+}
+
+/**
+  *
+  * Purpose: An approximate engine for the default mode in a well-mixed world (GRID 0),
+  * for populations too large to simulate one organism at a time. Hosts are counted
+  * by their interaction value bin, their symbionts' bin and how many symbionts they
+  * have; each update, births, deaths, transmission and mutation are drawn for whole
+  * classes of hosts at once (tau-leaping), so an update costs the same however many
+  * organisms there are.
+  *
+  * Organisms' points are not tracked: a host reproduces with chance (its resources
+  * per update / HOST_REPRO_RES) each update, and a symbiont transmits horizontally
+  * with chance (its resources / SYM_HORIZ_TRANS_RES), so the rates match the
+  * individual-based engine's on average but not its timing (e.g. the first births
+  * are not all at once). A host's symbionts share one bin: a symbiont joining a
+  * host moves them all to the bin of their mean.
+  *
+*/
+class TauLeapWorld {
+private:
+  emp::Random & random;
+  emp::Ptr<SymConfigBase> my_config;
+  size_t num_bins;
+  size_t sym_limit;
+  size_t num_cells;
+  size_t update = 0;
+
+  emp::vector<double> traits;
+  emp::vector<size_t> hist_bins;
+
+  /**
+    *
+    * Purpose: uninfected[h] is the number of hosts in bin h without symbionts, and
+    * infected[InfectedIndex(h, s, k)] the number in bin h with k symbionts in bin s.
+    *
+  */
+  emp::vector<size_t> uninfected;
+  emp::vector<size_t> infected;
+
+  /**
+    *
+    * Purpose: What a host in bin h and a symbiont in bin s get each update from
+    * RES_DISTRIBUTE resources split between them. A host with k symbionts gives each
+    * 1/k of its resources, so it gets the same and each symbiont 1/k of this.
+    *
+  */
+  emp::vector<emp::vector<double>> host_pair_gain;
+  emp::vector<emp::vector<double>> sym_pair_gain;
+
+  TraitKernel host_kernel;
+  TraitKernel sym_kernel;
+
+  emp::vector<emp::Ptr<emp::DataFile>> files;
+
+  size_t InfectedIndex(size_t h, size_t s, size_t k) const { return (h * num_bins + s) * sym_limit + k - 1; }
+
+public:
+  /**
+   * Input: The random number generator and the configuration.
+   *
+   * Output: None
+   *
+   * Purpose: To set up an empty world. Throws if the configuration uses something
+   * the engine does not model.
+   */
+  TauLeapWorld(emp::Random & _random, emp::Ptr<SymConfigBase> _config)
+    : random(_random), my_config(_config) {
+    if (my_config->GRID()) throw "TAU_LEAP needs a well-mixed world (GRID 0)";
+    if (my_config->FREE_LIVING_SYMS()) throw "TAU_LEAP does not model free-living symbionts";
+    if (my_config->LIMITED_RES_TOTAL() != -1) throw "TAU_LEAP does not model limited resources";
+    if (my_config->HOST_AGE_MAX() > 0 || my_config->SYM_AGE_MAX() > 0) throw "TAU_LEAP does not model aging";
+    if (my_config->PHYLOGENY()) throw "TAU_LEAP does not track phylogenies";
+    if (my_config->TAU_LEAP_BINS() < 2) throw "TAU_LEAP_BINS must be at least 2";
+
+    num_bins = my_config->TAU_LEAP_BINS();
+    sym_limit = std::max(my_config->SYM_LIMIT(), 0);
+    num_cells = my_config->GRID_X() * my_config->GRID_Y();
+    traits = MakeTraits(num_bins);
+    hist_bins.resize(num_bins);
+    for (size_t i = 0; i < num_bins; i++) hist_bins[i] = GetHistBin(traits[i]);
+    uninfected.assign(num_bins, 0);
+    infected.assign(num_bins * num_bins * sym_limit, 0);
+    MakePairGains(traits, *my_config, host_pair_gain, sym_pair_gain);
+    SetKernels();
+  }
+
+  ~TauLeapWorld() {
+    for (emp::Ptr<emp::DataFile> file : files) file.Delete();
+  }
+
+  TauLeapWorld(const TauLeapWorld &) = delete;
+  TauLeapWorld & operator=(const TauLeapWorld &) = delete;
+
+  size_t GetUpdate() const { return update; }
+  size_t GetNumBins() const { return num_bins; }
+  double GetTrait(size_t bin) const { return traits[bin]; }
+
+  /**
+   * Input: An interaction value.
+   *
+   * Output: The bin whose value is closest to it.
+   *
+   * Purpose: To put an interaction value into a bin.
+   */
+  size_t GetTraitBin(double value) const {
+    double position = (std::min(1.0, std::max(-1.0, value)) + 1.0) / 2.0 * (num_bins - 1);
+    return std::min(num_bins - 1, (size_t) std::round(position));
+  }
+
+  /**
+   * Input: The number of hosts, their interaction value, and the number and
+   * interaction value of each one's symbionts.
+   *
+   * Output: None
+   *
+   * Purpose: To add hosts to the world.
+   */
+  void AddHosts(size_t count, double host_int, size_t num_syms = 0, double sym_int = 0) {
+    num_syms = std::min(num_syms, sym_limit);
+    if (num_syms == 0) uninfected[GetTraitBin(host_int)] += count;
+    else infected[InfectedIndex(GetTraitBin(host_int), GetTraitBin(sym_int), num_syms)] += count;
+  }
+
+  size_t GetNumUninfectedHosts() const {
+    size_t total = 0;
+    for (size_t count : uninfected) total += count;
+    return total;
+  }
+
+  size_t GetNumHosts() const {
+    size_t total = GetNumUninfectedHosts();
+    for (size_t count : infected) total += count;
+    return total;
+  }
+
+  size_t GetNumSyms() const {
+    size_t total = 0;
+    for (size_t i = 0; i < infected.size(); i++) total += infected[i] * (i % sym_limit + 1);
+    return total;
+  }
+
+  double GetMeanHostIntVal() const {
+    double total = 0;
+    for (size_t h = 0; h < num_bins; h++) total += uninfected[h] * traits[h];
+    for (size_t i = 0; i < infected.size(); i++) total += infected[i] * traits[i / sym_limit / num_bins];
+    return total / GetNumHosts();
+  }
+
+  double GetMeanSymIntVal() const {
+    double total = 0;
+    for (size_t i = 0; i < infected.size(); i++) total += infected[i] * (i % sym_limit + 1) * traits[i / sym_limit % num_bins];
+    return total / GetNumSyms();
+  }
+
+  /**
+   * Input: The index of a data file histogram bin (0 for -1 to <-0.9, ..., 19 for 0.9 to 1).
+   *
+   * Output: The number of hosts (or symbionts) whose interaction value falls in it.
+   *
+   * Purpose: To fill in the data files' histograms.
+   */
+  size_t GetHostHistCount(size_t hist_bin) const {
+    size_t total = 0;
+    for (size_t h = 0; h < num_bins; h++) if (hist_bins[h] == hist_bin) total += uninfected[h];
+    for (size_t i = 0; i < infected.size(); i++) {
+      if (hist_bins[i / sym_limit / num_bins] == hist_bin) total += infected[i];
+    }
+    return total;
+  }
+
+  size_t GetSymHistCount(size_t hist_bin) const {
+    size_t total = 0;
+    for (size_t i = 0; i < infected.size(); i++) {
+      if (hist_bins[i / sym_limit % num_bins] == hist_bin) total += infected[i] * (i % sym_limit + 1);
+    }
+    return total;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To set up the mutation kernels from the MUTATION settings.
+   */
+  void SetKernels() {
+    double host_size = my_config->HOST_MUTATION_SIZE();
+    if (host_size == -1) host_size = my_config->MUTATION_SIZE();
+    double host_rate = my_config->HOST_MUTATION_RATE();
+    if (host_rate == -1) host_rate = my_config->MUTATION_RATE();
+    host_kernel = MakeTraitKernel(traits, host_rate, host_size);
+    sym_kernel = MakeTraitKernel(traits, my_config->MUTATION_RATE(), my_config->MUTATION_SIZE());
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To turn mutation off for the no-mutation updates.
+   */
+  void SetMutationZero() {
+    host_kernel = MakeTraitKernel(traits, 0, 0);
+    sym_kernel = MakeTraitKernel(traits, 0, 0);
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To build the starting population like worldSetup does, but for whole
+   * classes at once: POP_SIZE hosts with HOST_INT (or random, or the competition
+   * mode's two values), and POP_SIZE * START_MOI symbionts with SYM_INT (or random),
+   * each thrown at a random cell and kept if it lands in a host with room for it.
+   */
+  void Setup() {
+    size_t pop_size = my_config->POP_SIZE() == -1 ? num_cells : std::min<size_t>(my_config->POP_SIZE(), num_cells);
+    emp::vector<double> host_weights(num_bins, 0);
+    if (my_config->HOST_INT() == -2 && !my_config->COMPETITION_MODE()) {
+      for (size_t h = 0; h < num_bins; h++) host_weights[h] = (h == 0 || h == num_bins - 1) ? 0.5 : 1;
+    } else if (my_config->COMPETITION_MODE()) {
+      host_weights[GetTraitBin(0)] += (pop_size + 1) / 2;
+      host_weights[GetTraitBin(0.95)] += pop_size / 2;
+    } else {
+      host_weights[GetTraitBin(my_config->HOST_INT())] = 1;
+    }
+    emp::vector<double> sym_weights(num_bins, 0);
+    if (my_config->SYM_INT() == -2) {
+      for (size_t s = 0; s < num_bins; s++) sym_weights[s] = (s == 0 || s == num_bins - 1) ? 0.5 : 1;
+    } else {
+      sym_weights[GetTraitBin(my_config->SYM_INT())] = 1;
+    }
+
+    // symbionts that land in hosts are spread over them about as a Poisson distribution
+    size_t total_syms = pop_size * my_config->START_MOI();
+    size_t landed = pop_size > 0 ? DrawBinomial(random, total_syms, (double) pop_size / num_cells) : 0;
+    double mean_landed = pop_size > 0 ? (double) landed / pop_size : 0;
+    emp::vector<double> sym_count_weights(sym_limit + 1, 0);
+    double poisson = std::exp(-mean_landed);
+    double tail = 1;
+    for (size_t k = 0; k < sym_limit; k++) {
+      sym_count_weights[k] = poisson;
+      tail -= poisson;
+      poisson *= mean_landed / (k + 1);
+    }
+    sym_count_weights[sym_limit] = std::max(0.0, tail);
+
+    emp::vector<size_t> host_counts, sym_counts, trait_counts;
+    DrawMultinomial(random, pop_size, host_weights, host_counts);
+    for (size_t h = 0; h < num_bins; h++) {
+      if (host_counts[h] == 0) continue;
+      DrawMultinomial(random, host_counts[h], sym_count_weights, sym_counts);
+      uninfected[h] += sym_counts[0];
+      for (size_t k = 1; k <= sym_limit; k++) {
+        DrawMultinomial(random, sym_counts[k], sym_weights, trait_counts);
+        for (size_t s = 0; s < num_bins; s++) infected[InfectedIndex(h, s, k)] += trait_counts[s];
+      }
+    }
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To set up the HostVals and SymVals data files, with the same columns
+   * as the individual-based engine's.
+   */
+  void CreateDataFiles() {
+    std::string file_ending = "_SEED"+std::to_string(my_config->SEED())+".data";
+    emp::Ptr<emp::DataFile> host_file = emp::NewPtr<emp::DataFile>(my_config->FILE_PATH()+"HostVals"+my_config->FILE_NAME()+file_ending);
+    host_file->AddVar(update, "update", "Update");
+    host_file->AddFun<double>([this](){ return GetMeanHostIntVal(); }, "mean_intval", "Average host interaction value");
+    host_file->AddFun<size_t>([this](){ return GetNumHosts(); }, "count", "Total number of hosts");
+    host_file->AddFun<size_t>([this](){ return GetNumUninfectedHosts(); }, "uninfected_host_count", "Total number of hosts that are uninfected");
+    AddHistColumns<size_t>(*host_file, [this](size_t bin){ return GetHostHistCount(bin); });
+    emp::Ptr<emp::DataFile> sym_file = emp::NewPtr<emp::DataFile>(my_config->FILE_PATH()+"SymVals"+my_config->FILE_NAME()+file_ending);
+    sym_file->AddVar(update, "update", "Update");
+    sym_file->AddFun<double>([this](){ return GetMeanSymIntVal(); }, "mean_intval", "Average symbiont interaction value");
+    sym_file->AddFun<size_t>([this](){ return GetNumSyms(); }, "count", "Total number of symbionts");
+    AddHistColumns<size_t>(*sym_file, [this](size_t bin){ return GetSymHistCount(bin); });
+    for (emp::Ptr<emp::DataFile> file : {host_file, sym_file}) {
+      file->SetTimingRepeat(my_config->DATA_INT());
+      file->PrintHeaderKeys();
+      files.push_back(file);
+    }
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To write the data files and advance the population one update: hosts
+   * reproduce into random cells (replacing what was there) and take vertically
+   * transmitted symbionts along, and symbionts transmit horizontally into random
+   * hosts with room for them. Every event's chance comes from the population as it
+   * was at the start of the update.
+   */
+  void Update() {
+    for (emp::Ptr<emp::DataFile> file : files) file->Update(update);
+    if (GetNumHosts() > 0) Leap();
+    update++;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To run UPDATES updates and then NO_MUT_UPDATES without mutation.
+   */
+  void RunExperiment(bool verbose=true) {
+    int num_updates = my_config->UPDATES();
+    for (int i = 0; i < num_updates; i++) {
+      if (verbose && (i%my_config->DATA_INT()) == 0) std::cout << "Update: " << i << std::endl;
+      Update();
+    }
+    int num_no_mut_updates = my_config->NO_MUT_UPDATES();
+    if (num_no_mut_updates > 0) SetMutationZero();
+    for (int i = 0; i < num_no_mut_updates; i++) {
+      if (verbose && (i%my_config->DATA_INT()) == 0) std::cout << "No mutation update: " << i << std::endl;
+      Update();
+    }
+  }
+
+private:
+  /**
+   * Input: The random number generator's draws, a parent class's number of births
+   * and its mutation kernel row.
+   *
+   * Output: None
+   *
+   * Purpose: To spread births over the bins their offspring mutate into.
+   */
+  void DrawOffspringBins(size_t births, const emp::vector<std::pair<size_t, double>> & moves,
+                         emp::vector<std::pair<size_t, size_t>> & offspring) {
+    offspring.clear();
+    double remaining = 1;
+    for (const auto & move : moves) {
+      if (births == 0) break;
+      size_t count = move.second >= remaining ? births : DrawBinomial(random, births, move.second / remaining);
+      if (count > 0) offspring.emplace_back(move.first, count);
+      births -= count;
+      remaining -= move.second;
+    }
+  }
+
+  void Leap() {
+    double repro_res = my_config->HOST_REPRO_RES();
+    double horiz_res = my_config->SYM_HORIZ_TRANS_RES();
+    double vert_res = my_config->SYM_VERT_TRANS_RES();
+    double resources = my_config->RES_DISTRIBUTE();
+    size_t num_hosts = GetNumHosts();
+
+    // a symbiont has the points to transmit vertically if it has not just spent them
+    // on horizontal transmission, which leaves its points spread over [0, SYM_HORIZ_TRANS_RES)
+    double vert_ready = 1;
+    if (vert_res > 0 && my_config->HORIZ_TRANS() && horiz_res > 0) vert_ready = std::max(0.0, 1 - vert_res / horiz_res);
+    double vert_chance = my_config->VERTICAL_TRANSMISSION() * vert_ready;
+    // vert_count_weights[k][j]: the chance j of a host's k symbionts go with its offspring
+    emp::vector<emp::vector<double>> vert_count_weights(sym_limit + 1);
+    for (size_t k = 0; k <= sym_limit; k++) {
+      for (size_t j = 0; j <= k; j++) {
+        vert_count_weights[k].push_back(std::exp(std::lgamma(k + 1.0) - std::lgamma(j + 1.0) - std::lgamma(k - j + 1.0))
+          * std::pow(vert_chance, j) * std::pow(1 - vert_chance, k - j));
+      }
+    }
+    auto birth_rate = [repro_res](double gain){ return repro_res > 0 ? std::min(1.0, gain / repro_res) : 1; };
+    // an offspring whose random cell is its parent's is not born
+    double placed_chance = num_cells > 1 ? 1 - 1.0 / num_cells : 0;
+
+    // host births, with their vertically transmitted symbionts, and horizontal
+    // transmission offspring (by trait), all from the population as it is now
+    emp::vector<size_t> born_uninfected(num_bins, 0);
+    emp::vector<size_t> born_infected(infected.size(), 0);
+    emp::vector<size_t> horiz_offspring(num_bins, 0);
+    emp::vector<std::pair<size_t, size_t>> child_bins, sym_child_bins;
+    emp::vector<size_t> vert_counts;
+    size_t num_placed = 0;
+    for (size_t h = 0; h < num_bins; h++) {
+      size_t births = DrawBinomial(random, DrawBinomial(random, uninfected[h], birth_rate(resources * (1 - std::abs(traits[h])))), placed_chance);
+      num_placed += births;
+      DrawOffspringBins(births, host_kernel[h], child_bins);
+      for (const auto & child : child_bins) born_uninfected[child.first] += child.second;
+    }
+    for (size_t i = 0; i < infected.size(); i++) {
+      if (infected[i] == 0) continue;
+      size_t k = i % sym_limit + 1;
+      size_t s = i / sym_limit % num_bins;
+      size_t h = i / sym_limit / num_bins;
+      double host_rate = birth_rate(host_pair_gain[h][s]);
+      size_t births = DrawBinomial(random, DrawBinomial(random, infected[i], host_rate), placed_chance);
+      num_placed += births;
+      DrawOffspringBins(births, host_kernel[h], child_bins);
+      for (const auto & child : child_bins) {
+        DrawMultinomial(random, child.second, vert_count_weights[k], vert_counts);
+        born_uninfected[child.first] += vert_counts[0];
+        for (size_t j = 1; j <= k; j++) {
+          // an offspring's symbionts mutate together, as they share a bin
+          DrawOffspringBins(vert_counts[j], sym_kernel[s], sym_child_bins);
+          for (const auto & sym_child : sym_child_bins) born_infected[InfectedIndex(child.first, sym_child.first, j)] += sym_child.second;
+        }
+      }
+
+      if (!my_config->HORIZ_TRANS()) continue;
+      double sym_gain = std::max(0.0, sym_pair_gain[h][s] / k - vert_res * vert_chance * host_rate);
+      size_t sym_births = DrawBinomial(random, infected[i] * k, horiz_res > 0 ? std::min(1.0, sym_gain / horiz_res) : 1);
+      DrawOffspringBins(sym_births, sym_kernel[s], sym_child_bins);
+      for (const auto & sym_child : sym_child_bins) horiz_offspring[sym_child.first] += sym_child.second;
+    }
+
+    // each placed offspring lands in a random other cell, replacing any host there
+    size_t num_victims = DrawBinomial(random, num_placed, (double) num_hosts / num_cells);
+    if (num_placed > num_victims + (num_cells - num_hosts)) num_victims = num_placed - (num_cells - num_hosts);
+    emp::vector<size_t> classes(uninfected);
+    classes.insert(classes.end(), infected.begin(), infected.end());
+    emp::vector<size_t> victims = DrawWithoutReplacement(random, classes, num_victims);
+    for (size_t h = 0; h < num_bins; h++) uninfected[h] += born_uninfected[h] - victims[h];
+    for (size_t i = 0; i < infected.size(); i++) infected[i] += born_infected[i] - victims[num_bins + i];
+
+    // horizontally transmitted offspring infect random hosts, if they have room
+    size_t num_horiz = 0;
+    for (size_t count : horiz_offspring) num_horiz += count;
+    if (num_horiz == 0) return;
+    emp::vector<double> class_weights(uninfected.begin(), uninfected.end());
+    class_weights.insert(class_weights.end(), infected.begin(), infected.end());
+    emp::vector<size_t> hits;
+    DrawMultinomial(random, num_horiz, class_weights, hits);
+    emp::vector<size_t> newly_infected(infected.size(), 0);
+    for (size_t c = 0; c < class_weights.size(); c++) {
+      if (hits[c] == 0) continue;
+      size_t h = c < num_bins ? c : (c - num_bins) / sym_limit / num_bins;
+      size_t s = c < num_bins ? 0 : (c - num_bins) / sym_limit % num_bins;
+      size_t k = c < num_bins ? 0 : (c - num_bins) % sym_limit + 1;
+      if (k == sym_limit) continue; // full hosts turn them away
+      size_t count = c < num_bins ? uninfected[h] : infected[c - num_bins];
+      emp::vector<size_t> arriving = DrawWithoutReplacement(random, horiz_offspring, std::min(hits[c], count));
+      for (size_t arrival = 0; arrival < num_bins; arrival++) {
+        if (arriving[arrival] == 0) continue;
+        if (k == 0) uninfected[h] -= arriving[arrival];
+        else infected[c - num_bins] -= arriving[arrival];
+        size_t merged = k == 0 ? arrival : GetTraitBin((k * traits[s] + traits[arrival]) / (k + 1));
+        newly_infected[InfectedIndex(h, merged, k + 1)] += arriving[arrival];
+      }
+    }
+    for (size_t i = 0; i < infected.size(); i++) infected[i] += newly_infected[i];
+  }
+};
+#endif
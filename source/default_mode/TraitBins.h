@@ -0,0 +1,148 @@
+#ifndef TRAIT_BINS_H
+#define TRAIT_BINS_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../../Empirical/include/emp/data/DataFile.hpp"
+#include "../ConfigSetup.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+/**
+ * Input: The number of bins.
+ *
+ * Output: The interaction value of each bin.
+ *
+ * Purpose: To spread bins evenly from -1 to 1, for the engines that count organisms
+ * by interaction value bin instead of simulating them one at a time.
+ */
+emp::vector<double> MakeTraits(size_t num_bins) {
+  emp::vector<double> traits(num_bins);
+  for (size_t i = 0; i < num_bins; i++) traits[i] = -1.0 + 2.0 * i / (num_bins - 1);
+  return traits;
+}
+
+/**
+ * Input: An interaction value.
+ *
+ * Output: The data files' histogram bin (0 for -1 to <-0.9, ..., 19 for 0.9 to <1,
+ * and 20, which is not written, for 1).
+ *
+ * Purpose: To count a value the way Empirical's data nodes do, by adding up steps
+ * of 0.1 from -1.
+ */
+size_t GetHistBin(double value) {
+  double bin_end = -1.0;
+  for (size_t bin = 0; bin < 21; bin++) {
+    bin_end += 0.1;
+    if (bin_end > value) return bin;
+  }
+  return 20;
+}
+
+/**
+ * Input: The interaction value of each bin, the configuration, and where to put the
+ * resources a host and a symbiont in each pair of bins get.
+ *
+ * Output: None
+ *
+ * Purpose: To work out, as Host::DistribResToSym, Symbiont::ProcessResources and
+ * Host::StealResources do, what a host in bin h and a symbiont in bin s get each
+ * update from RES_DISTRIBUTE resources split between them.
+ */
+void MakePairGains(const emp::vector<double> & traits, SymConfigBase & config,
+                   emp::vector<emp::vector<double>> & host_gain, emp::vector<emp::vector<double>> & sym_gain) {
+  size_t num_bins = traits.size();
+  double resources = config.RES_DISTRIBUTE();
+  host_gain.assign(num_bins, emp::vector<double>(num_bins, 0));
+  sym_gain.assign(num_bins, emp::vector<double>(num_bins, 0));
+  for (size_t h = 0; h < num_bins; h++) {
+    for (size_t s = 0; s < num_bins; s++) {
+      double host_int = traits[h];
+      double sym_int = traits[s];
+      double donation = host_int >= 0 ? host_int * resources : 0;
+      double kept = host_int >= 0 ? resources - donation : resources + host_int * resources;
+      if (sym_int < 0) {
+        double defense = std::min(host_int, 0.0);
+        double stolen = sym_int < defense ? (defense - sym_int) * kept : 0;
+        host_gain[h][s] = kept - stolen;
+        sym_gain[h][s] = stolen + donation;
+      } else {
+        host_gain[h][s] = kept + donation * sym_int * config.SYNERGY();
+        sym_gain[h][s] = donation * (1 - sym_int);
+      }
+    }
+  }
+}
+
+/**
+  *
+  * Purpose: For each trait bin, the bins an offspring's trait can land in and the
+  * chance of each.
+  *
+*/
+using TraitKernel = emp::vector<emp::vector<std::pair<size_t, double>>>;
+
+/**
+ * Input: The trait value of each bin (evenly spaced from -1 to 1), the mutation rate
+ * and the mutation size.
+ *
+ * Output: The mutation kernel.
+ *
+ * Purpose: To turn mutation (a normal step, clamped to [-1, 1], with chance rate) into
+ * moves between bins. The step is rounded to the nearest bin, and if bins are too
+ * coarse for rounding to keep the step's variance, the missing variance is made up
+ * with moves to the neighboring bins, so traits diffuse as fast as they do unbinned.
+ */
+TraitKernel MakeTraitKernel(const emp::vector<double> & traits, double rate, double size) {
+  size_t num_bins = traits.size();
+  double bin_width = traits[1] - traits[0];
+  TraitKernel kernel(num_bins);
+  auto normal_cdf = [](double z){ return 0.5 * std::erfc(-z / std::sqrt(2.0)); };
+  for (size_t i = 0; i < num_bins; i++) {
+    if (rate <= 0 || size <= 0) {
+      kernel[i].emplace_back(i, 1.0);
+      continue;
+    }
+    size_t reach = (size_t) std::ceil(6 * size / bin_width) + 1;
+    size_t first = i > reach ? i - reach : 0;
+    size_t last = std::min(num_bins - 1, i + reach);
+    emp::vector<double> probs(last - first + 1, 0);
+    double variance = 0;
+    for (size_t j = first; j <= last; j++) {
+      double lower = j == 0 ? -INFINITY : (traits[j] - bin_width / 2 - traits[i]) / size;
+      double upper = j == num_bins - 1 ? INFINITY : (traits[j] + bin_width / 2 - traits[i]) / size;
+      probs[j - first] = normal_cdf(upper) - normal_cdf(lower);
+      variance += probs[j - first] * (traits[j] - traits[i]) * (traits[j] - traits[i]);
+    }
+    if (variance < size * size && i > 0 && i + 1 < num_bins) {
+      double extra = std::min((size * size - variance) / (2 * bin_width * bin_width), probs[i - first] / 2);
+      probs[i - first] -= 2 * extra;
+      probs[i - 1 - first] += extra;
+      probs[i + 1 - first] += extra;
+    }
+    for (size_t j = first; j <= last; j++) {
+      double p = rate * probs[j - first] + (j == i ? 1 - rate : 0);
+      if (p > 1e-12) kernel[i].emplace_back(j, p);
+    }
+  }
+  return kernel;
+}
+
+/**
+ * Input: A data file and a function giving the count in a data file histogram bin.
+ *
+ * Output: None
+ *
+ * Purpose: To add the Hist_-1, ..., Hist_0.9 columns.
+ */
+template <typename T, typename HIST_COUNT>
+void AddHistColumns(emp::DataFile & file, HIST_COUNT hist_count) {
+  const char * names[] = {"Hist_-1", "Hist_-0.9", "Hist_-0.8", "Hist_-0.7", "Hist_-0.6", "Hist_-0.5",
+    "Hist_-0.4", "Hist_-0.3", "Hist_-0.2", "Hist_-0.1", "Hist_0.0", "Hist_0.1", "Hist_0.2", "Hist_0.3",
+    "Hist_0.4", "Hist_0.5", "Hist_0.6", "Hist_0.7", "Hist_0.8", "Hist_0.9"};
+  for (size_t bin = 0; bin < 20; bin++) {
+    file.AddFun<T>([hist_count, bin](){ return hist_count(bin); }, names[bin], "Count for histogram bin");
+  }
+}
+#endif
@@ -0,0 +1,75 @@
+#ifndef TREATMENTS_H
+#define TREATMENTS_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../ConfigSetup.h"
+#include <sstream>
+#include <string>
+#include <utility>
+
+/**
+  *
+  * Purpose: The settings one treatment changes from the base configuration, as
+  * (setting name, value) pairs in the order they were given.
+  *
+*/
+using Treatment = emp::vector<std::pair<std::string, std::string>>;
+
+/**
+ * Input: The TREATMENTS setting: treatments separated by semicolons, each a list
+ * of NAME=VALUE overrides separated by commas
+ * (e.g. "VERTICAL_TRANSMISSION=0.2;VERTICAL_TRANSMISSION=0.8,SYNERGY=3"). An empty
+ * treatment runs the base configuration unchanged.
+ *
+ * Output: The treatments, in order.
+ *
+ * Purpose: To read the TREATMENTS setting. Throws if an override is not NAME=VALUE.
+ */
+emp::vector<Treatment> ParseTreatments(const std::string & treatments_text) {
+  emp::vector<Treatment> treatments;
+  std::stringstream treatments_ss(treatments_text);
+  std::string treatment_text;
+  while (std::getline(treatments_ss, treatment_text, ';')) {
+    Treatment treatment;
+    std::stringstream overrides_ss(treatment_text);
+    std::string override_text;
+    while (std::getline(overrides_ss, override_text, ',')) {
+      size_t start = override_text.find_first_not_of(" ");
+      if (start == std::string::npos) continue;
+      size_t end = override_text.find_last_not_of(" ");
+      override_text = override_text.substr(start, end - start + 1);
+      size_t equals = override_text.find('=');
+      if (equals == std::string::npos || equals == 0) throw "TREATMENTS overrides must be written NAME=VALUE";
+      treatment.emplace_back(override_text.substr(0, equals), override_text.substr(equals + 1));
+    }
+    treatments.push_back(treatment);
+  }
+  return treatments;
+}
+
+/**
+ * Input: The configuration and a treatment.
+ *
+ * Output: None
+ *
+ * Purpose: To check that every setting a treatment overrides exists, so a typo
+ * is caught before the burn-in is run rather than after.
+ */
+void CheckTreatment(SymConfigBase & config, const Treatment & treatment) {
+  for (const auto & setting : treatment) {
+    if (!config.Has(setting.first)) throw "TREATMENTS overrides a setting that does not exist";
+  }
+}
+
+/**
+ * Input: The configuration and a treatment.
+ *
+ * Output: None
+ *
+ * Purpose: To apply a treatment's overrides to the configuration.
+ */
+void ApplyTreatment(SymConfigBase & config, const Treatment & treatment) {
+  CheckTreatment(config, treatment);
+  for (const auto & setting : treatment) config.Set(setting.first, setting.second);
+}
+#endif
@@ -0,0 +1,176 @@
+#ifndef WORLD_DIGEST_H
+#define WORLD_DIGEST_H
+
+#include "../../Empirical/include/emp/math/Random.hpp"
+#include "Checkpoint.h"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+/**
+  *
+  * Purpose: A stream buffer that keeps a 64-bit FNV-1a hash of every byte written to
+  * it instead of storing them, so anything that can be written to a checkpoint can
+  * be hashed the same way.
+  *
+*/
+class DigestStreambuf : public std::streambuf {
+private:
+  uint64_t hash;
+
+  void Add(unsigned char byte) {
+    hash ^= byte;
+    hash *= 0x100000001b3;
+  }
+
+protected:
+  int_type overflow(int_type ch) override {
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) Add(traits_type::to_char_type(ch));
+    return traits_type::not_eof(ch);
+  }
+
+  std::streamsize xsputn(const char * data, std::streamsize size) override {
+    for (std::streamsize i = 0; i < size; i++) Add(data[i]);
+    return size;
+  }
+
+public:
+  DigestStreambuf(uint64_t start = 0xcbf29ce484222325) : hash(start) {}
+
+  uint64_t GetHash() const { return hash; }
+};
+
+/**
+  *
+  * Purpose: A way in to the random number generator's protected state, so its
+  * fields can be written one by one rather than as the raw bytes of the object,
+  * which would also take in its padding.
+  *
+*/
+struct RandomState : public emp::Random {
+  /**
+   * Input: The writer to write to and the random number generator to write.
+   *
+   * Output: None
+   *
+   * Purpose: To write the generator's seed, engine state and Weyl counter, and the
+   * normal value it is holding for its next draw.
+   */
+  static void Write(CheckpointWriter & writer, const emp::Random & random) {
+    writer.Write(random.*(&RandomState::seed));
+    writer.Write(random.*(&RandomState::value));
+    writer.Write(random.*(&RandomState::weyl_state));
+    writer.Write(random.*(&RandomState::expRV));
+  }
+};
+
+/**
+  *
+  * Purpose: The digest of one update of a world: a hash of the previous digest, the
+  * update, where each organism is and its state (as written to a checkpoint), and
+  * the random number generator's state. Since each digest takes in the one before,
+  * two runs' digests differ from the first update their worlds differ on.
+  *
+*/
+class WorldDigest {
+private:
+  DigestStreambuf buffer;
+  std::ostream os;
+  CheckpointWriter writer;
+
+public:
+  /**
+   * Input: The previous digest and the update being digested.
+   *
+   * Output: None
+   *
+   * Purpose: To start the digest of an update.
+   */
+  WorldDigest(uint64_t previous, size_t update) : os(&buffer), writer(os) {
+    writer.Write<uint64_t>(previous);
+    writer.Write<uint64_t>(update);
+  }
+
+  /**
+   * Input: Whether the organism is a free-living symbiont (rather than a host), the
+   * cell it is in, and the organism.
+   *
+   * Output: None
+   *
+   * Purpose: To add an organism, with its symbionts if it is a host, to the digest.
+   */
+  template <typename ORG>
+  void AddOrganism(bool free_sym, size_t cell, ORG & org) {
+    writer.Write<bool>(free_sym);
+    writer.Write<uint64_t>(cell);
+    writer.WriteString(org.GetName());
+    org.WriteState(writer);
+  }
+
+  /**
+   * Input: The random number generator.
+   *
+   * Output: None
+   *
+   * Purpose: To add the random number generator's state to the digest.
+   */
+  void AddRandom(const emp::Random & random) { RandomState::Write(writer, random); }
+
+  uint64_t Get() const { return buffer.GetHash(); }
+};
+
+/**
+ * Input: A digest.
+ *
+ * Output: The digest as 16 hexadecimal digits.
+ *
+ * Purpose: To write digests to the digest file.
+ */
+std::string FormatDigest(uint64_t digest) {
+  char text[17];
+  snprintf(text, sizeof(text), "%016llx", (unsigned long long) digest);
+  return text;
+}
+
+/**
+  *
+  * Purpose: Where two digest files first disagree. first_update is -1 if they agree
+  * on every update both have; common_updates counts those updates.
+  *
+*/
+struct DigestComparison {
+  long first_update = -1;
+  size_t common_updates = 0;
+};
+
+/**
+ * Input: The names of two digest files (update,digest rows after a header).
+ *
+ * Output: The first update whose digests differ, and how many updates the files share.
+ *
+ * Purpose: To find where two runs that should behave the same stopped doing so.
+ * Throws if a file cannot be read or its updates do not line up with the other's.
+ */
+DigestComparison CompareDigestFiles(const std::string & filename_a, const std::string & filename_b) {
+  std::ifstream in_a(filename_a), in_b(filename_b);
+  if (!in_a || !in_b) throw "Could not open digest file";
+  std::string line_a, line_b;
+  std::getline(in_a, line_a);
+  std::getline(in_b, line_b);
+  DigestComparison comparison;
+  while (std::getline(in_a, line_a) && std::getline(in_b, line_b)) {
+    size_t comma_a = line_a.find(','), comma_b = line_b.find(',');
+    if (comma_a == std::string::npos || comma_b == std::string::npos) throw "Digest file rows must be update,digest";
+    if (line_a.substr(0, comma_a) != line_b.substr(0, comma_b)) throw "Digest files were not written at the same updates";
+    if (line_a.substr(comma_a) != line_b.substr(comma_b)) {
+      comparison.first_update = std::stol(line_a.substr(0, comma_a));
+      return comparison;
+    }
+    comparison.common_updates++;
+  }
+  return comparison;
+}
+#endif
@@ -5,6 +5,8 @@
 #include "../ConfigSetup.h"
 #include "Host.h"
 #include "Symbiont.h"
+#include "PopulationFile.h"
+#include "BulkSetup.h"
 
 
 void worldSetup(emp::Ptr<SymWorld> world, emp::Ptr<SymConfigBase> my_config) {
@@ -25,6 +27,18 @@ void worldSetup(emp::Ptr<SymWorld> world, emp::Ptr<SymConfigBase> my_config) {
 
   if (my_config->GRID() == 0) {world->SetPopStruct_Mixed(false);}
   else world->SetPopStruct_Grid(my_config->GRID_X(), my_config->GRID_Y(), false);
+  world->DetectEventListeners();
+
+  //a population file replaces the hosts and symbionts built below
+  if (SeedPopulationFromFile(world, my_config,
+        [&](double int_val){ return emp::NewPtr<Host>(&random, world, my_config, int_val); },
+        [&](double int_val){ return emp::NewPtr<Symbiont>(&random, world, my_config, int_val, 0); })) return;
+  if (my_config->BULK_SETUP()) {
+    BulkPopulationSetup(world, my_config,
+      [&](emp::Random & chunk_random, double int_val){ return emp::NewPtr<Host>(&chunk_random, world, my_config, int_val); },
+      [&](emp::Random & chunk_random, double int_val){ return emp::NewPtr<Symbiont>(&chunk_random, world, my_config, int_val, 0); });
+    return;
+  }
 
 
   double comp_host_1 = 0;
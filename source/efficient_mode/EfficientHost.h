@@ -74,6 +74,30 @@ public:
     return  "EfficientHost";
   }
 
+  /**
+   * Input: The writer of the checkpoint being saved.
+   *
+   * Output: None
+   *
+   * Purpose: To save the efficient host's state, after the host state it inherits, to a checkpoint.
+   */
+  void WriteState(CheckpointWriter & writer) {
+    Host::WriteState(writer);
+    writer.Write(efficiency);
+  }
+
+  /**
+   * Input: The reader of the checkpoint being loaded.
+   *
+   * Output: None
+   *
+   * Purpose: To restore the efficient host's state saved by WriteState.
+   */
+  void ReadState(CheckpointReader & reader) {
+    Host::ReadState(reader);
+    efficiency = reader.Read<double>();
+  }
+
   /**
    * Input: Efficiency value
    *
@@ -108,4 +132,17 @@ public:
     return host_baby;
   }
 };
+
+/**
+ * Input: The class name of a host saved in a checkpoint.
+ *
+ * Output: A new host of that class, whose state is then read from the checkpoint.
+ *
+ * Purpose: To recreate efficient hosts when loading a checkpoint.
+ */
+emp::Ptr<Organism> EfficientWorld::MakeCheckpointHost(const std::string & name) {
+  if (name == "EfficientHost") return emp::NewPtr<EfficientHost>(&GetRandom(), this, my_config);
+  return SymWorld::MakeCheckpointHost(name);
+}
+
 #endif
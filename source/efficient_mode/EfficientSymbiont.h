@@ -109,6 +109,36 @@ public:
     return  "EfficientSymbiont";
   }
 
+  /**
+   * Input: The writer of the checkpoint being saved.
+   *
+   * Output: None
+   *
+   * Purpose: To save the efficient symbiont's state, after the symbiont state it inherits, to a checkpoint.
+   */
+  void WriteState(CheckpointWriter & writer) {
+    Symbiont::WriteState(writer);
+    writer.Write(efficiency);
+    writer.Write(ht_mut_size);
+    writer.Write(ht_mut_rate);
+    writer.Write(eff_mut_rate);
+  }
+
+  /**
+   * Input: The reader of the checkpoint being loaded.
+   *
+   * Output: None
+   *
+   * Purpose: To restore the efficient symbiont's state saved by WriteState.
+   */
+  void ReadState(CheckpointReader & reader) {
+    Symbiont::ReadState(reader);
+    efficiency = reader.Read<double>();
+    ht_mut_size = reader.Read<double>();
+    ht_mut_rate = reader.Read<double>();
+    eff_mut_rate = reader.Read<double>();
+  }
+
   /**
    * Input: Efficiency value
    *
@@ -245,7 +275,7 @@ public:
       host_baby->AddSymbiont(sym_baby);
 
       //vertical transmission data node
-      emp::DataMonitor<int>& data_node_attempts_verttrans = my_world->GetVerticalTransmissionAttemptCount();
+      EventCounter& data_node_attempts_verttrans = my_world->GetVerticalTransmissionAttemptCount();
       data_node_attempts_verttrans.AddDatum(1);
     }
   }
@@ -263,14 +293,14 @@ public:
         // symbiont reproduces independently (horizontal transmission) if it has enough resources
         // new symbiont in this host with mutated value
         SetPoints(0); //TODO: test just subtracting points instead of setting to 0
-        emp::Ptr<Organism> sym_baby = Reproduce("horizontal");
-        emp::WorldPosition new_pos = my_world->SymDoBirth(sym_baby, location);
+        //the offspring is only made if it has somewhere to go
+        emp::WorldPosition new_pos = my_world->SymDoBirthIfPlaced([this](){ return Reproduce("horizontal"); }, location);
 
         //horizontal transmission data nodes
-        emp::DataMonitor<int>& data_node_attempts_horiztrans = my_world->GetHorizontalTransmissionAttemptCount();
+        EventCounter& data_node_attempts_horiztrans = my_world->GetHorizontalTransmissionAttemptCount();
         data_node_attempts_horiztrans.AddDatum(1);
 
-        emp::DataMonitor<int>& data_node_successes_horiztrans = my_world->GetHorizontalTransmissionSuccessCount();
+        EventCounter& data_node_successes_horiztrans = my_world->GetHorizontalTransmissionSuccessCount();
         if(new_pos.IsValid()){
           data_node_successes_horiztrans.AddDatum(1);
         }
@@ -278,4 +308,17 @@ public:
     }
   }
 };
+
+/**
+ * Input: The class name of a symbiont saved in a checkpoint.
+ *
+ * Output: A new symbiont of that class, whose state is then read from the checkpoint.
+ *
+ * Purpose: To recreate efficient symbionts when loading a checkpoint.
+ */
+emp::Ptr<Organism> EfficientWorld::MakeCheckpointSym(const std::string & name) {
+  if (name == "EfficientSymbiont") return emp::NewPtr<EfficientSymbiont>(&GetRandom(), this, my_config);
+  return SymWorld::MakeCheckpointSym(name);
+}
+
 #endif
@@ -15,6 +15,10 @@ private:
 public:
   using SymWorld::SymWorld;
 
+  //recreate organisms from checkpoints; defined after the EfficientHost and EfficientSymbiont classes
+  emp::Ptr<Organism> MakeCheckpointHost(const std::string & name) override;
+  emp::Ptr<Organism> MakeCheckpointSym(const std::string & name) override;
+
   /**
    * Input: None
    *
@@ -70,13 +74,12 @@ public:
     if (!data_node_efficiency) {
       data_node_efficiency.New();
       OnUpdate([this](size_t){
+        HostedSymTable & table = UseHostedSymTable();
         data_node_efficiency->Reset();
         for (size_t i = 0; i< pop.size(); i++) {
           if (IsOccupied(i)) {
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-            size_t sym_size = syms.size();
-            for(size_t j=0; j< sym_size; j++){
-              data_node_efficiency->AddDatum(syms[j]->GetEfficiency());
+            for(size_t j = table.Begin(i); j < table.End(i); j++){
+              data_node_efficiency->AddDatum(table.GetSym(j)->GetEfficiency());
             }//close for
           }//close if
           if(sym_pop[i]) {
@@ -5,6 +5,8 @@
 #include "../ConfigSetup.h"
 #include "EfficientSymbiont.h"
 #include "EfficientHost.h"
+#include "../default_mode/PopulationFile.h"
+#include "../default_mode/BulkSetup.h"
 #include "../default_mode/WorldSetup.cc"
 
 void efficientWorldSetup(emp::Ptr<EfficientWorld> world, emp::Ptr<SymConfigBase> my_config) {
@@ -27,6 +29,18 @@ void efficientWorldSetup(emp::Ptr<EfficientWorld> world, emp::Ptr<SymConfigBase>
 
   if (my_config->GRID() == 0) {world->SetPopStruct_Mixed(false);}
   else world->SetPopStruct_Grid(my_config->GRID_X(), my_config->GRID_Y(), false);
+  world->DetectEventListeners();
+
+  //a population file replaces the hosts and symbionts built below
+  if (SeedPopulationFromFile(world, my_config,
+        [&](double int_val){ return emp::NewPtr<EfficientHost>(&random, world, my_config, int_val); },
+        [&](double int_val){ return emp::NewPtr<EfficientSymbiont>(&random, world, my_config, int_val, 0, 1); })) return;
+  if (my_config->BULK_SETUP()) {
+    BulkPopulationSetup(world, my_config,
+      [&](emp::Random & chunk_random, double int_val){ return emp::NewPtr<EfficientHost>(&chunk_random, world, my_config, int_val); },
+      [&](emp::Random & chunk_random, double int_val){ return emp::NewPtr<EfficientSymbiont>(&chunk_random, world, my_config, int_val, 0, 1); });
+    return;
+  }
 // settings
 
   double comp_host_1 = 0;
@@ -82,6 +82,30 @@ public:
     return  "Bacterium";
   }
 
+  /**
+   * Input: The writer of the checkpoint being saved.
+   *
+   * Output: None
+   *
+   * Purpose: To save the bacterium's state, after the host state it inherits, to a checkpoint.
+   */
+  void WriteState(CheckpointWriter & writer) {
+    Host::WriteState(writer);
+    writer.Write(host_incorporation_val);
+  }
+
+  /**
+   * Input: The reader of the checkpoint being loaded.
+   *
+   * Output: None
+   *
+   * Purpose: To restore the bacterium's state saved by WriteState.
+   */
+  void ReadState(CheckpointReader & reader) {
+    Host::ReadState(reader);
+    host_incorporation_val = reader.Read<double>();
+  }
+
   /**
    * Input: None
    *
@@ -147,4 +171,17 @@ public:
   }
 
 };//Bacterium
+
+/**
+ * Input: The class name of a host saved in a checkpoint.
+ *
+ * Output: A new host of that class, whose state is then read from the checkpoint.
+ *
+ * Purpose: To recreate bacteria when loading a checkpoint.
+ */
+emp::Ptr<Organism> LysisWorld::MakeCheckpointHost(const std::string & name) {
+  if (name == "Bacterium") return emp::NewPtr<Bacterium>(&GetRandom(), this, my_config);
+  return SymWorld::MakeCheckpointHost(name);
+}
+
 #endif
@@ -13,9 +13,9 @@ private:
   */
   emp::Ptr<emp::DataMonitor<double, emp::data::Histogram>> data_node_lysischance;
   emp::Ptr<emp::DataMonitor<double, emp::data::Histogram>> data_node_inductionchance;
-  emp::Ptr<emp::DataMonitor<double, emp::data::Histogram>> data_node_incorporation_difference;
-  emp::Ptr<emp::DataMonitor<double>> data_node_burst_size;
-  emp::Ptr<emp::DataMonitor<int>> data_node_burst_count;
+  emp::Ptr<PairStats> data_node_incval_pairs;
+  emp::Ptr<EventCounter> data_node_burst_size;
+  emp::Ptr<EventCounter> data_node_burst_count;
   emp::Ptr<emp::DataMonitor<int>> data_node_cfu;
 
 public:
@@ -31,7 +31,6 @@ public:
   ~LysisWorld(){
     if (data_node_lysischance) data_node_lysischance.Delete();
     if (data_node_inductionchance) data_node_inductionchance.Delete();
-    if (data_node_incorporation_difference) data_node_incorporation_difference.Delete();
     if (data_node_burst_size) data_node_burst_size.Delete();
     if (data_node_burst_count) data_node_burst_count.Delete();
     if (data_node_cfu) data_node_cfu.Delete();
@@ -52,6 +51,61 @@ public:
     SetupIncorporationDifferenceFile(my_config->FILE_PATH()+"IncValDifferences"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(my_config->DATA_INT());
   }
 
+  /**
+   * Input: The snapshot to fill.
+   *
+   * Output: None
+   *
+   * Purpose: To add the running total of lytic bursts to the live metrics.
+   */
+  void FillMetrics(MetricsSnapshot & snapshot) override {
+    SymWorld::FillMetrics(snapshot);
+    snapshot.burst_count = GetBurstCountDataNode().GetTotal();
+  }
+
+  //recreate organisms from checkpoints; defined after the Bacterium and Phage classes
+  emp::Ptr<Organism> MakeCheckpointHost(const std::string & name) override;
+  emp::Ptr<Organism> MakeCheckpointSym(const std::string & name) override;
+
+  /**
+   * Input: The writer of the checkpoint being saved.
+   *
+   * Output: None
+   *
+   * Purpose: To add the lytic burst counters to the world's checkpoint.
+   */
+  void WriteCheckpoint(CheckpointWriter & writer) override {
+    SymWorld::WriteCheckpoint(writer);
+    WriteCounter(writer, GetBurstSizeDataNode());
+    WriteCounter(writer, GetBurstCountDataNode());
+  }
+
+  /**
+   * Input: The reader of the checkpoint being loaded.
+   *
+   * Output: None
+   *
+   * Purpose: To restore the state saved by WriteCheckpoint.
+   */
+  void ReadCheckpoint(CheckpointReader & reader) override {
+    SymWorld::ReadCheckpoint(reader);
+    ReadCounter(reader, GetBurstSizeDataNode());
+    ReadCounter(reader, GetBurstCountDataNode());
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To also treat the lysis counters' events so far as reported.
+   */
+  void MarkEventsReported() override {
+    SymWorld::MarkEventsReported();
+    GetBurstSizeDataNode().MarkReported();
+    GetBurstCountDataNode().MarkReported();
+  }
+
   /**
    * Input: The Empirical DataFile object tracking data nodes.
    *
@@ -59,7 +113,7 @@ public:
    *
    * Purpose: To add bacterium data nodes to be tracked to the bacterium data file.
    */
-  void SetupHostFileColumns(emp::DataFile & file){
+  void SetupHostFileColumns(emp::DataFile & file) override {
     SymWorld::SetupHostFileColumns(file);
     auto & cfu_node = GetCFUDataNode();
     file.AddTotal(cfu_node, "cfu_count", "Total number of colony forming units"); //colony forming units are hosts that
@@ -83,8 +137,16 @@ public:
     auto & node3 = GetBurstCountDataNode();
     file.AddVar(update, "update", "Update");
     file.AddTotal(node1, "count", "Total number of symbionts");
-    file.AddMean(node2, "mean_burstsize", "Average burst size", true);
-    file.AddTotal(node3, "burst_count", "Average burst count", true);
+    //burst counters are cumulative, so before each row the file closes off the bursts
+    //since the previous row for its columns
+    file.AddPreFun([&node2, &node3](){
+      node2.MarkReported();
+      node3.MarkReported();
+    });
+    file.AddFun<double>([&node2](){
+      return (double) node2.GetLastReportTotal() / (double) node2.GetLastReportCount();
+    }, "mean_burstsize", "Average burst size");
+    file.AddFun<size_t>([&node3](){ return node3.GetLastReportTotal(); }, "burst_count", "Average burst count");
     file.AddMean(node, "mean_lysischance", "Average chance of lysis");
     file.AddHistBin(node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
     file.AddHistBin(node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
@@ -180,13 +242,12 @@ public:
     if (!data_node_lysischance) {
       data_node_lysischance.New();
       OnUpdate([this](size_t){
+        HostedSymTable & table = UseHostedSymTable();
         data_node_lysischance->Reset();
         for (size_t i = 0; i< pop.size(); i++) {
           if (IsOccupied(i)) {
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-            long unsigned int sym_size = syms.size();
-            for(size_t j=0; j< sym_size; j++){
-              data_node_lysischance->AddDatum(syms[j]->GetLysisChance());
+            for(size_t j = table.Begin(i); j < table.End(i); j++){
+              data_node_lysischance->AddDatum(table.GetSym(j)->GetLysisChance());
             }//close for
           }//close if
           if (sym_pop[i]){
@@ -202,13 +263,13 @@ public:
   /**
    * Input: None
    *
-   * Output: The DataMonitor<double>& that has the information representing
+   * Output: The EventCounter& that has the information representing
    * the lysis burst size.
    *
    * Purpose: To collect data on the lysis burst size to be saved to the
    * data file that is tracking lysis burst size.
    */
-  emp::DataMonitor<double>& GetBurstSizeDataNode() {
+  EventCounter& GetBurstSizeDataNode() {
     if (!data_node_burst_size) {
       data_node_burst_size.New();
     }
@@ -219,13 +280,13 @@ public:
   /**
    * Input: None
    *
-   * Output: The DataMonitor<int>& that has the information representing
+   * Output: The EventCounter& that has the information representing
    * the lysis burst count.
    *
    * Purpose: To collect data on the lysis burst count to be saved to the
    * data file that is tracking lysis burst count.
    */
-  emp::DataMonitor<int>& GetBurstCountDataNode() {
+  EventCounter& GetBurstCountDataNode() {
     if (!data_node_burst_count) {
       data_node_burst_count.New();
     }
@@ -245,13 +306,12 @@ public:
     if (!data_node_inductionchance) {
       data_node_inductionchance.New();
       OnUpdate([this](size_t){
+        HostedSymTable & table = UseHostedSymTable();
         data_node_inductionchance->Reset();
         for (size_t i = 0; i< pop.size(); i++) {
           if (IsOccupied(i)) {
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-            long unsigned int sym_size = syms.size();
-            for(size_t j=0; j< sym_size; j++){
-              data_node_inductionchance->AddDatum(syms[j]->GetInductionChance());
+            for(size_t j = table.Begin(i); j < table.End(i); j++){
+              data_node_inductionchance->AddDatum(table.GetSym(j)->GetInductionChance());
             }//close for
           }//close if
           if (sym_pop[i]){
@@ -274,26 +334,25 @@ public:
    * to be saved to the data file that is tracking incorporation val differences.
    */
   emp::DataMonitor<double,emp::data::Histogram>& GetIncorporationDifferenceDataNode() {
-    if (!data_node_incorporation_difference) {
-      data_node_incorporation_difference.New();
-      OnUpdate([this](size_t){
-        data_node_incorporation_difference->Reset();
-        for (size_t i = 0; i< pop.size(); i++) {
-          if (IsOccupied(i)) {
-            double host_inc_val = pop[i]->GetIncVal();
+    return GetIncValPairDataNode().GetMismatchDataNode();
+  }
 
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-            long unsigned int sym_size = syms.size();
-            for(size_t j=0; j< sym_size; j++){
-              double inc_val_difference = abs(host_inc_val - syms[j]->GetIncVal());
-              data_node_incorporation_difference->AddDatum(inc_val_difference);
-            }
-          }//close if
-        }//close for
-      });
+  /**
+   * Input: None
+   *
+   * Output: The PairStats& that has the information representing how bacterium
+   * incorporation values relate to those of their phage.
+   *
+   * Purpose: To collect incorporation value pair statistics during the host
+   * traversal; the pairs' mismatch is the incorporation difference.
+   */
+  PairStats& GetIncValPairDataNode() {
+    if (!data_node_incval_pairs) {
+      //pair stats are owned (and deleted) by SymWorld
+      data_node_incval_pairs = &AddPairStats([](Organism & org){ return org.GetIncVal(); },
+        [](Organism & org){ return org.GetIncVal(); }, 0, 1.1, 11);
     }
-    data_node_incorporation_difference->SetupBins(0, 1.1, 11);
-    return *data_node_incorporation_difference;
+    return *data_node_incval_pairs;
   }
 
   /**
@@ -310,21 +369,22 @@ public:
     if(!data_node_cfu) {
       data_node_cfu.New();
       OnUpdate([this](size_t){
+        HostedSymTable & table = UseHostedSymTable();
         data_node_cfu -> Reset();
 
         for (size_t i = 0; i < pop.size(); i++) {
           if(IsOccupied(i)) {
             //uninfected hosts
-            if((pop[i]->GetSymbionts()).empty()) {
+            if(table.GetCount(i) == 0) {
               data_node_cfu->AddDatum(1);
             }
 
             //infected hosts, check if all symbionts are lysogenic
-            if(pop[i]->HasSym()) {
-              emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
+            if(table.GetCount(i) > 0) {
               bool all_lysogenic = true;
-              for(long unsigned int j = 0; j < syms.size(); j++){
-                if(syms[j]->IsPhage() && syms[j]->GetLysogeny() == false){
+              for(size_t j = table.Begin(i); j < table.End(i); j++){
+                emp::Ptr<Organism> sym = table.GetSym(j);
+                if(sym->IsPhage() && sym->GetLysogeny() == false){
                   all_lysogenic = false;
                 }
               }
@@ -5,6 +5,8 @@
 #include "../ConfigSetup.h"
 #include "Phage.h"
 #include "Bacterium.h"
+#include "../default_mode/PopulationFile.h"
+#include "../default_mode/BulkSetup.h"
 
 void worldSetup(emp::Ptr<LysisWorld> world, emp::Ptr<SymConfigBase> my_config) {
 // params
@@ -24,12 +26,36 @@ void worldSetup(emp::Ptr<LysisWorld> world, emp::Ptr<SymConfigBase> my_config) {
 
   if (my_config->GRID() == 0) {world->SetPopStruct_Mixed(false);}
   else world->SetPopStruct_Grid(my_config->GRID_X(), my_config->GRID_Y(), false);
+  world->DetectEventListeners();
 // settings
 
   const bool STAGGER_STARTING_BURST_TIMERS = true;
   double comp_host_1 = 0;
   double comp_host_2 = 0.95;
 
+  //a population file replaces the bacteria and phage built below
+  if (SeedPopulationFromFile(world, my_config,
+        [&](double int_val){ return emp::NewPtr<Bacterium>(&random, world, my_config, int_val); },
+        [&](double int_val){
+          emp::Ptr<Phage> new_sym = emp::NewPtr<Phage>(&random, world, my_config, int_val, 0);
+          if(STAGGER_STARTING_BURST_TIMERS) {
+            new_sym->SetBurstTimer(random.GetInt(-5,5));
+          }
+          return new_sym;
+        })) return;
+  if (my_config->BULK_SETUP()) {
+    BulkPopulationSetup(world, my_config,
+      [&](emp::Random & chunk_random, double int_val){ return emp::NewPtr<Bacterium>(&chunk_random, world, my_config, int_val); },
+      [&](emp::Random & chunk_random, double int_val){
+        emp::Ptr<Phage> new_sym = emp::NewPtr<Phage>(&chunk_random, world, my_config, int_val, 0);
+        if(STAGGER_STARTING_BURST_TIMERS) {
+          new_sym->SetBurstTimer(chunk_random.GetInt(-5,5));
+        }
+        return new_sym;
+      });
+    return;
+  }
+
   //inject bacteriums
   for (size_t i = 0; i < POP_SIZE; i++){
     emp::Ptr<Bacterium> new_org;
@@ -110,6 +110,38 @@ public:
     return  "Phage";
   }
 
+  /**
+   * Input: The writer of the checkpoint being saved.
+   *
+   * Output: None
+   *
+   * Purpose: To save the phage's state, after the symbiont state it inherits, to a checkpoint.
+   */
+  void WriteState(CheckpointWriter & writer) {
+    Symbiont::WriteState(writer);
+    writer.Write(burst_timer);
+    writer.Write(lysogeny);
+    writer.Write(incorporation_val);
+    writer.Write(chance_of_lysis);
+    writer.Write(induction_chance);
+  }
+
+  /**
+   * Input: The reader of the checkpoint being loaded.
+   *
+   * Output: None
+   *
+   * Purpose: To restore the phage's state saved by WriteState.
+   */
+  void ReadState(CheckpointReader & reader) {
+    Symbiont::ReadState(reader);
+    burst_timer = reader.Read<double>();
+    lysogeny = reader.Read<bool>();
+    incorporation_val = reader.Read<double>();
+    chance_of_lysis = reader.Read<double>();
+    induction_chance = reader.Read<double>();
+  }
+
   /**Input: None
    *
    * Output: The double representing the phage's burst timer.
@@ -296,12 +328,13 @@ public:
   void LysisBurst(emp::WorldPosition location){
     emp::vector<emp::Ptr<Organism>>& repro_syms = my_host->GetReproSymbionts();
     //Record the burst size and count
-    emp::DataMonitor<double>& data_node_burst_size = my_world->GetBurstSizeDataNode();
+    EventCounter& data_node_burst_size = my_world->GetBurstSizeDataNode();
     data_node_burst_size.AddDatum(repro_syms.size());
-    emp::DataMonitor<int>& data_node_burst_count = my_world->GetBurstCountDataNode();
+    EventCounter& data_node_burst_count = my_world->GetBurstCountDataNode();
     data_node_burst_count.AddDatum(1);
-    emp::DataMonitor<int>& data_node_attempts_horiztrans = my_world->GetHorizontalTransmissionAttemptCount();
-    emp::DataMonitor<int>& data_node_successes_horiztrans = my_world->GetHorizontalTransmissionSuccessCount();
+    if (my_world->GetEventLog()) my_world->GetEventLog()->LysisBurst(location.GetPopID(), repro_syms.size());
+    EventCounter& data_node_attempts_horiztrans = my_world->GetHorizontalTransmissionAttemptCount();
+    EventCounter& data_node_successes_horiztrans = my_world->GetHorizontalTransmissionSuccessCount();
 
     for(size_t r=0; r<repro_syms.size(); r++) {
       emp::WorldPosition new_pos = my_world->SymDoBirth(repro_syms[r], location);
@@ -354,7 +387,7 @@ public:
       host_baby->AddSymbiont(phage_baby);
 
       //vertical transmission data node
-      emp::DataMonitor<int>& data_node_attempts_verttrans = my_world->GetVerticalTransmissionAttemptCount();
+      EventCounter& data_node_attempts_verttrans = my_world->GetVerticalTransmissionAttemptCount();
       data_node_attempts_verttrans.AddDatum(1);
     }
   }
@@ -419,4 +452,17 @@ public:
     }
   }
 };
+
+/**
+ * Input: The class name of a symbiont saved in a checkpoint.
+ *
+ * Output: A new symbiont of that class, whose state is then read from the checkpoint.
+ *
+ * Purpose: To recreate phage when loading a checkpoint.
+ */
+emp::Ptr<Organism> LysisWorld::MakeCheckpointSym(const std::string & name) {
+  if (name == "Phage") return emp::NewPtr<Phage>(&GetRandom(), this, my_config);
+  return SymWorld::MakeCheckpointSym(name);
+}
+
 #endif
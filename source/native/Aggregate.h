@@ -0,0 +1,238 @@
+#ifndef AGGREGATE_H
+#define AGGREGATE_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+  *
+  * Purpose: Represents which rows and columns symbulation-aggregate keeps.
+  *
+*/
+struct AggregateOptions {
+  emp::vector<std::string> columns = {"mean_intval"}; // columns to emit a row for
+  long first_update = -1;                             // -1 for no lower bound
+  long last_update = -1;                              // -1 for no upper bound
+  bool final_only = false;                            // only keep each file's last update
+};
+
+/**
+  *
+  * Purpose: Represents the labels of one run's data file, taken from its name,
+  * e.g. HostVals_VT0.5_SEED12.data is partner Host, treatment VT0.5, rep 12.
+  *
+*/
+struct RunInfo {
+  std::string uid;
+  std::string treatment;
+  std::string rep;
+  std::string partner;
+};
+
+/**
+ * Input: The path of a symbulation data file.
+ *
+ * Output: The run labels found in its name. Names that do not follow the
+ * <Partner>Vals<FILE_NAME>_SEED<seed>.data pattern use the whole name as the
+ * treatment, rep 0 and no partner.
+ *
+ * Purpose: To label a file's rows by treatment, replicate and partner.
+ */
+RunInfo ParseRunName(const std::string & path) {
+  std::string name = path.substr(path.find_last_of('/') + 1);
+  if (name.size() > 5 && name.compare(name.size() - 5, 5, ".data") == 0) name.resize(name.size() - 5);
+
+  RunInfo info;
+  size_t vals = name.find("Vals");
+  size_t seed = name.rfind("_SEED");
+  if (vals == std::string::npos || seed == std::string::npos || seed < vals) {
+    info.treatment = name;
+    info.rep = "0";
+  } else {
+    info.partner = name.substr(0, vals);
+    info.treatment = name.substr(vals + 4, seed - vals - 4);
+    info.treatment.erase(0, info.treatment.find_first_not_of('_'));
+    info.rep = name.substr(seed + 5);
+  }
+  if (info.treatment == "") info.treatment = "none";
+  if (info.partner == "") info.partner = "NA";
+  info.uid = info.treatment + "_" + info.rep;
+  return info;
+}
+
+/**
+ * Input: The contents of a data file, its run labels, and the options.
+ *
+ * Output: The long-format rows ("uid treatment rep update value partner", plus the
+ * column name when more than one column is selected) for the selected updates and columns.
+ *
+ * Purpose: To turn one run's CSV data into rows of the combined table. Values are
+ * copied as written, without being reparsed.
+ */
+std::string AggregateBuffer(const char * data, size_t size, const RunInfo & info, const AggregateOptions & options) {
+  const char * end = data + size;
+  const char * line = data;
+  bool with_column = options.columns.size() > 1;
+
+  // the header names the columns; find the selected ones
+  const char * header_end = std::find(line, end, '\n');
+  emp::vector<long> selected(options.columns.size(), -1);
+  size_t col = 0;
+  for (const char * field = line; field <= header_end && field < end; col++) {
+    const char * field_end = std::find(field, header_end, ',');
+    std::string key(field, field_end);
+    if (!key.empty() && key.back() == '\r') key.pop_back();
+    for (size_t i = 0; i < options.columns.size(); i++) if (options.columns[i] == key) selected[i] = col;
+    field = field_end + 1;
+  }
+  for (size_t i = 0; i < selected.size(); i++) {
+    if (selected[i] < 0) throw "A selected column is not in the data file's header";
+  }
+
+  // with final_only, only the last data line is kept
+  line = header_end < end ? header_end + 1 : end;
+  if (options.final_only) {
+    const char * last = line;
+    for (const char * cur = line; cur < end;) {
+      const char * cur_end = std::find(cur, end, '\n');
+      if (cur_end > cur) last = cur;
+      cur = cur_end + 1;
+    }
+    line = last;
+  }
+
+  std::string out;
+  emp::vector<std::pair<const char *, const char *>> fields;
+  while (line < end) {
+    const char * line_end = std::find(line, end, '\n');
+    if (line_end == line) { line = line_end + 1; continue; }
+    long update = strtol(line, nullptr, 10);
+    bool in_range = (options.first_update < 0 || update >= options.first_update)
+                 && (options.last_update < 0 || update <= options.last_update);
+    if (in_range) {
+      fields.clear();
+      for (const char * field = line; field <= line_end && field < end;) {
+        const char * field_end = std::find(field, line_end, ',');
+        fields.emplace_back(field, field_end);
+        field = field_end + 1;
+      }
+      for (size_t i = 0; i < selected.size(); i++) {
+        if ((size_t) selected[i] >= fields.size()) continue;
+        const auto & value = fields[selected[i]];
+        const char * value_end = value.second;
+        if (value_end > value.first && value_end[-1] == '\r') value_end--;
+        out += info.uid; out += ' ';
+        out += info.treatment; out += ' ';
+        out += info.rep; out += ' ';
+        out += std::to_string(update); out += ' ';
+        out.append(value.first, value_end); out += ' ';
+        out += info.partner;
+        if (with_column) { out += ' '; out += options.columns[i]; }
+        out += '\n';
+      }
+    }
+    line = line_end + 1;
+  }
+  return out;
+}
+
+/**
+ * Input: The path of a data file and the options.
+ *
+ * Output: The long-format rows for that file.
+ *
+ * Purpose: To memory-map a data file and aggregate it.
+ */
+std::string AggregateFile(const std::string & path, const AggregateOptions & options) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw "Could not open a data file";
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    throw "Could not read a data file";
+  }
+  size_t size = file_stat.st_size;
+  if (size == 0) {
+    close(fd);
+    return "";
+  }
+  void * data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) throw "Could not map a data file";
+  madvise(data, size, MADV_SEQUENTIAL);
+  std::string rows;
+  try {
+    rows = AggregateBuffer(static_cast<const char *>(data), size, ParseRunName(path), options);
+  } catch (...) {
+    munmap(data, size);
+    throw;
+  }
+  munmap(data, size);
+  return rows;
+}
+
+/**
+ * Input: The options (the value column is named after the single selected column,
+ * or "value" when there are several).
+ *
+ * Output: The header line of the combined table.
+ *
+ * Purpose: To label the combined table's columns the way the R scripts expect.
+ */
+std::string AggregateHeader(const AggregateOptions & options) {
+  if (options.columns.size() == 1) return "uid treatment rep update " + options.columns[0] + " partner\n";
+  return "uid treatment rep update value partner column\n";
+}
+
+/**
+ * Input: The data files, the options, the number of threads, and where to write.
+ *
+ * Output: The number of files that could not be aggregated (their errors are
+ * written to err).
+ *
+ * Purpose: To aggregate many files in parallel, writing their rows in the order
+ * the files were given.
+ */
+size_t AggregateFiles(const emp::vector<std::string> & paths, const AggregateOptions & options,
+                      size_t num_threads, std::ostream & os, std::ostream & err) {
+  emp::vector<std::string> results(paths.size());
+  emp::vector<std::string> errors(paths.size());
+  std::atomic<size_t> next{0};
+  auto worker = [&](){
+    for (size_t i = next++; i < paths.size(); i = next++) {
+      try {
+        results[i] = AggregateFile(paths[i], options);
+      } catch (const char * error) {
+        errors[i] = error;
+      }
+    }
+  };
+  num_threads = std::max<size_t>(1, std::min(num_threads, paths.size()));
+  emp::vector<std::thread> threads;
+  for (size_t t = 1; t < num_threads; t++) threads.emplace_back(worker);
+  worker();
+  for (std::thread & thread : threads) thread.join();
+
+  size_t failures = 0;
+  os << AggregateHeader(options);
+  for (size_t i = 0; i < paths.size(); i++) {
+    if (errors[i] != "") {
+      err << paths[i] << ": " << errors[i] << std::endl;
+      failures++;
+    }
+    os << results[i];
+  }
+  return failures;
+}
+#endif
@@ -1,7 +1,15 @@
 #include "../../Empirical/include/emp/config/ArgManager.hpp"
 #include "../../Empirical/include/emp/config/config.hpp"
+#include <functional>
 #include <iostream>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include "../ConfigSetup.h"
+#include "../default_mode/Islands.h"
+#include "../default_mode/MeanFieldWorld.h"
+#include "../default_mode/ReplicateAggregator.h"
+#include "../default_mode/Treatments.h"
 
 /**
  * Input: The SymConfig object and the command line arguments.
@@ -27,3 +35,290 @@ void CheckConfigFile(SymConfigBase& config, int argc, char * argv[]){
     exit(1);
   }
 }
+
+
+/**
+ * Input: The SymConfig object.
+ *
+ * Output: A new SymConfig object with the same settings, to be deleted by the caller.
+ *
+ * Purpose: To give each of several worlds run side by side its own settings.
+ */
+emp::Ptr<SymConfigBase> CopyConfig(SymConfigBase & config) {
+  emp::Ptr<SymConfigBase> copy = emp::NewPtr<SymConfigBase>();
+  for (auto & group : config.GetGroupSet()) {
+    for (size_t i = 0; i < group->GetSize(); ++i) {
+      copy->Set(group->GetEntry(i)->GetName(), group->GetEntry(i)->GetValue());
+    }
+  }
+  return copy;
+}
+
+
+/**
+ * Input: The SymConfig object, the function that sets up a replicate's world, and
+ * optionally a function to call on each replicate's world once the run is over.
+ *
+ * Output: The exit status.
+ *
+ * Purpose: To run REPLICATES replicates of the configured treatment (seeds SEED,
+ * SEED+1, ...) side by side in this process, one update of each in turn, so that
+ * each data file step can be aggregated across replicates as soon as every replicate
+ * has written it. The data socket and metrics page, if any, follow the first replicate.
+ */
+template <typename WORLD_T>
+int RunReplicates(SymConfigBase & config, std::function<void(WORLD_T &, SymConfigBase &)> world_setup,
+                  std::function<void(WORLD_T &, SymConfigBase &)> finish = nullptr) {
+  size_t num_replicates = config.REPLICATES();
+  int first_seed = config.SEED();
+  std::string label = "_SEEDS" + std::to_string(first_seed) + "-" + std::to_string(first_seed + (int) num_replicates - 1);
+  ReplicateAggregator aggregator(num_replicates, label);
+
+  emp::vector<emp::Ptr<SymConfigBase>> configs;
+  emp::vector<emp::Ptr<emp::Random>> randoms;
+  emp::vector<emp::Ptr<WORLD_T>> worlds;
+  for (size_t rep = 0; rep < num_replicates; rep++) {
+    emp::Ptr<SymConfigBase> rep_config = CopyConfig(config);
+    rep_config->SEED(first_seed + (int) rep);
+    if (rep > 0) {
+      rep_config->DATA_SOCKET("");
+      rep_config->METRICS_SHM("");
+    }
+    configs.push_back(rep_config);
+    randoms.push_back(emp::NewPtr<emp::Random>(rep_config->SEED()));
+    worlds.push_back(emp::NewPtr<WORLD_T>(*randoms[rep], rep_config));
+    world_setup(*worlds[rep], *rep_config);
+    worlds[rep]->SetReplicateAggregator(&aggregator);
+    worlds[rep]->CreateDateFiles();
+  }
+
+  int num_updates = config.UPDATES();
+  for (int i = 0; i < num_updates; i++) {
+    if ((i%config.DATA_INT()) == 0) std::cout << "Update: " << i << std::endl;
+    for (emp::Ptr<WORLD_T> world : worlds) world->Update();
+  }
+  int num_no_mut_updates = config.NO_MUT_UPDATES();
+  if (num_no_mut_updates > 0) {
+    for (emp::Ptr<WORLD_T> world : worlds) world->SetMutationZero();
+  }
+  for (int i = 0; i < num_no_mut_updates; i++) {
+    if ((i%config.DATA_INT()) == 0) std::cout << "No mutation update: " << i << std::endl;
+    for (emp::Ptr<WORLD_T> world : worlds) world->Update();
+  }
+
+  for (size_t rep = 0; rep < num_replicates; rep++) {
+    if (finish) finish(*worlds[rep], *configs[rep]);
+    worlds[rep].Delete();
+    randoms[rep].Delete();
+    configs[rep].Delete();
+  }
+  return 0;
+}
+
+
+/**
+ * Input: The SymConfig object, the function that sets up the world, and optionally
+ * a function to call on each treatment's world once its run is over.
+ *
+ * Output: The exit status: 0 in the original process if every treatment finished,
+ * and each treatment's own process returns 0 when it is done.
+ *
+ * Purpose: To run the BURN_IN_UPDATES burn-in once with the base settings and then
+ * fork() a process per treatment in TREATMENTS. Each child shares the burn-in
+ * world copy-on-write, applies its overrides, adds _T<index> to FILE_NAME and
+ * runs on to UPDATES, so the burn-in is neither re-simulated nor re-allocated per
+ * treatment. The burn-in writes no data files. Every treatment continues from the
+ * same random number generator state; the data socket and metrics page, if any,
+ * follow the first treatment. Each treatment checkpoints to its own file (a set
+ * CHECKPOINT_FILE gets _T<index> added, like FILE_NAME), and resumes from it.
+ */
+template <typename WORLD_T>
+int RunTreatments(SymConfigBase & config, std::function<void(WORLD_T &, SymConfigBase &)> world_setup,
+                  std::function<void(WORLD_T &, SymConfigBase &)> finish = nullptr) {
+  if (config.REPLICATES() > 1) {
+    std::cerr << "TREATMENTS cannot be combined with REPLICATES; run each seed separately." << std::endl;
+    return 1;
+  }
+  emp::vector<Treatment> treatments = ParseTreatments(config.TREATMENTS());
+  for (const Treatment & treatment : treatments) CheckTreatment(config, treatment);
+
+  emp::Random random(config.SEED());
+  WORLD_T world(random, &config);
+  world_setup(world, config);
+  world.ResumeFromCheckpoint();
+
+  int burn_in_updates = config.BURN_IN_UPDATES();
+  for (int i = world.GetUpdate(); i < burn_in_updates; i++) {
+    if ((i%config.DATA_INT()) == 0) std::cout << "Burn-in update: " << i << std::endl;
+    world.Update();
+  }
+  world.MarkEventsReported();
+
+  // anything still buffered would otherwise be written once by every child
+  std::cout.flush();
+  std::cerr.flush();
+  emp::vector<pid_t> children;
+  for (size_t t = 0; t < treatments.size(); t++) {
+    pid_t pid = fork();
+    if (pid < 0) {
+      std::cerr << "Could not fork treatment " << t << "." << std::endl;
+      break;
+    }
+    if (pid == 0) {
+      // the child returns from here, so the world's files are closed as usual
+      ApplyTreatment(config, treatments[t]);
+      config.FILE_NAME(config.FILE_NAME() + "_T" + std::to_string(t));
+      if (config.CHECKPOINT_FILE() != "") config.CHECKPOINT_FILE(config.CHECKPOINT_FILE() + "_T" + std::to_string(t));
+      if (t > 0) {
+        config.DATA_SOCKET("");
+        config.METRICS_SHM("");
+      }
+      config.Write(config.FILE_PATH()+"SymSettings"+config.FILE_NAME()+"_SEED"+std::to_string(config.SEED())+".cfg");
+      world.ResumeFromCheckpoint();
+      world.CreateDateFiles();
+      world.RunExperiment(false);
+      if (finish) finish(world, config);
+      std::cout << "Treatment " << t << " finished at update " << world.GetUpdate() << std::endl;
+      return 0;
+    }
+    std::cout << "Treatment " << t << " started as process " << pid << std::endl;
+    children.push_back(pid);
+  }
+
+  int failed = (int) (treatments.size() - children.size());
+  for (pid_t pid : children) {
+    int status = 0;
+    if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) failed++;
+  }
+  if (failed > 0) {
+    std::cerr << failed << " treatment(s) failed." << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+
+/**
+ * Input: The SymConfig object, the function that sets up an island's world, and
+ * optionally a function to call on each island's world once the run is over.
+ *
+ * Output: The exit status.
+ *
+ * Purpose: To run ISLANDS islands (seeds SEED, SEED+1, ..., each with _I<index>
+ * added to FILE_NAME and its own data files and checkpoint) as one metapopulation.
+ * The islands run their updates in parallel, one island per thread at a time, and
+ * every MIGRATION_INT updates all of them stop to exchange migrants. The data
+ * socket and metrics page, if any, follow the first island. Each island's event
+ * log is started and flushed as in RunExperiment. The STOP_ settings are not
+ * supported, since islands that stopped on their own would leave the others
+ * without their migrants.
+ */
+template <typename WORLD_T>
+int RunIslands(SymConfigBase & config, std::function<void(WORLD_T &, SymConfigBase &)> world_setup,
+               std::function<void(WORLD_T &, SymConfigBase &)> finish = nullptr) {
+  if (config.REPLICATES() > 1 || config.TREATMENTS() != "") {
+    std::cerr << "ISLANDS cannot be combined with REPLICATES or TREATMENTS." << std::endl;
+    return 1;
+  }
+  if (StopConditions(config).Any()) {
+    std::cerr << "ISLANDS cannot be combined with the STOP_ settings." << std::endl;
+    return 1;
+  }
+  size_t num_islands = config.ISLANDS();
+  emp::vector<emp::Ptr<SymConfigBase>> configs;
+  emp::vector<emp::Ptr<emp::Random>> randoms;
+  emp::vector<emp::Ptr<WORLD_T>> islands;
+  for (size_t i = 0; i < num_islands; i++) {
+    emp::Ptr<SymConfigBase> island_config = CopyConfig(config);
+    island_config->SEED(config.SEED() + (int) i);
+    island_config->FILE_NAME(config.FILE_NAME() + "_I" + std::to_string(i));
+    if (config.CHECKPOINT_FILE() != "") island_config->CHECKPOINT_FILE(config.CHECKPOINT_FILE() + "_I" + std::to_string(i));
+    if (i > 0) {
+      island_config->DATA_SOCKET("");
+      island_config->METRICS_SHM("");
+    }
+    configs.push_back(island_config);
+    randoms.push_back(emp::NewPtr<emp::Random>(island_config->SEED()));
+    islands.push_back(emp::NewPtr<WORLD_T>(*randoms[i], island_config));
+    world_setup(*islands[i], *island_config);
+    islands[i]->ResumeFromCheckpoint();
+    islands[i]->CreateDateFiles();
+    islands[i]->StartRun();
+  }
+  int status = 0;
+  for (emp::Ptr<WORLD_T> island : islands) {
+    if (island->GetUpdate() != islands[0]->GetUpdate()) status = 1;
+  }
+  if (status != 0) std::cerr << "The islands' checkpoints were saved at different updates." << std::endl;
+
+  size_t num_updates = std::max(config.UPDATES(), 0);
+  size_t last_update = num_updates + std::max(config.NO_MUT_UPDATES(), 0);
+  size_t migration_int = std::max(config.MIGRATION_INT(), 1);
+  size_t data_int = std::max(config.DATA_INT(), 1);
+  // a run resumed from a checkpoint saved on a migration update still owes that migration
+  for (size_t update = islands[0]->GetUpdate(); status == 0 && update < last_update; update = islands[0]->GetUpdate()) {
+    if (update > 0 && update % migration_int == 0) MigrateBetweenIslands(islands, config.MIGRATION_RATE());
+    if (update >= num_updates) {
+      for (emp::Ptr<WORLD_T> island : islands) island->SetMutationZero();
+    }
+    size_t stop = std::min(last_update, (update / migration_int + 1) * migration_int);
+    if (update < num_updates) stop = std::min(stop, num_updates);
+    ForEachIsland(num_islands, [&](size_t i){
+      for (size_t u = update; u < stop; u++) {
+        if (i == 0 && u % data_int == 0) std::cout << "Update: " << u << std::endl;
+        islands[i]->Update();
+      }
+    });
+  }
+
+  for (size_t i = 0; i < num_islands; i++) {
+    islands[i]->FlushEventLog();
+    if (finish && status == 0) finish(*islands[i], *configs[i]);
+    islands[i].Delete();
+    randoms[i].Delete();
+    configs[i].Delete();
+  }
+  return status;
+}
+
+
+/**
+ * Input: The SymConfig object.
+ *
+ * Output: The exit status.
+ *
+ * Purpose: To solve the mean-field equations for the configured treatment, or, if
+ * TREATMENTS is set, for each treatment in turn (each from the start, with _T<index>
+ * added to FILE_NAME). Each solve is deterministic and takes milliseconds, so
+ * scans over many parameter points are run one after another in this process.
+ */
+int RunMeanField(SymConfigBase & config) {
+  if (config.REPLICATES() > 1 || config.ISLANDS() > 1 || config.BURN_IN_UPDATES() > 0) {
+    std::cerr << "MEAN_FIELD cannot be combined with REPLICATES, ISLANDS or BURN_IN_UPDATES." << std::endl;
+    return 1;
+  }
+  if (config.TREATMENTS() == "") {
+    MeanFieldWorld world(&config);
+    world.Setup();
+    world.CreateDataFiles();
+    world.RunExperiment();
+    return 0;
+  }
+  emp::vector<Treatment> treatments = ParseTreatments(config.TREATMENTS());
+  for (const Treatment & treatment : treatments) CheckTreatment(config, treatment);
+  for (size_t t = 0; t < treatments.size(); t++) {
+    emp::Ptr<SymConfigBase> treatment_config = CopyConfig(config);
+    ApplyTreatment(*treatment_config, treatments[t]);
+    treatment_config->FILE_NAME(config.FILE_NAME() + "_T" + std::to_string(t));
+    treatment_config->Write(config.FILE_PATH()+"SymSettings"+treatment_config->FILE_NAME()+"_SEED"+std::to_string(config.SEED())+".cfg");
+    {
+      MeanFieldWorld world(treatment_config);
+      world.Setup();
+      world.CreateDataFiles();
+      world.RunExperiment(false);
+    }
+    treatment_config.Delete();
+  }
+  std::cout << treatments.size() << " treatment(s) solved." << std::endl;
+  return 0;
+}
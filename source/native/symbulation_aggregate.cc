@@ -0,0 +1,73 @@
+#include "Aggregate.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+/**
+ * Input: None
+ *
+ * Output: None
+ *
+ * Purpose: To explain how to call symbulation-aggregate.
+ */
+void PrintAggregateUsage() {
+  std::cerr << "Usage: symbulation-aggregate [options] <data files>\n"
+            << "Combines symbulation data files (e.g. HostVals_<treatment>_SEED<rep>.data) into one\n"
+            << "long-format table: uid treatment rep update <value> partner.\n\n"
+            << "  -columns a,b,...   columns to extract (default mean_intval); with several, a\n"
+            << "                     trailing column field names each row's column\n"
+            << "  -updates first:last  only keep updates in this inclusive range (either may be empty)\n"
+            << "  -final             only keep the last update of each file\n"
+            << "  -threads n         number of files parsed at once (default: all cores)\n"
+            << "  -o file            write the table to file instead of standard output\n";
+}
+
+int main(int argc, char * argv[]) {
+  AggregateOptions options;
+  size_t num_threads = std::max(1u, std::thread::hardware_concurrency());
+  std::string out_name = "";
+  emp::vector<std::string> paths;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool has_value = i + 1 < argc;
+    if (arg == "-columns" && has_value) {
+      options.columns.clear();
+      std::stringstream columns(argv[++i]);
+      std::string column;
+      while (std::getline(columns, column, ',')) if (column != "") options.columns.push_back(column);
+    } else if (arg == "-updates" && has_value) {
+      std::string range = argv[++i];
+      size_t colon = range.find(':');
+      std::string first = range.substr(0, colon);
+      std::string last = colon == std::string::npos ? first : range.substr(colon + 1);
+      options.first_update = first == "" ? -1 : std::stol(first);
+      options.last_update = last == "" ? -1 : std::stol(last);
+    } else if (arg == "-final") {
+      options.final_only = true;
+    } else if (arg == "-threads" && has_value) {
+      num_threads = std::stoul(argv[++i]);
+    } else if (arg == "-o" && has_value) {
+      out_name = argv[++i];
+    } else if (arg.size() > 0 && arg[0] == '-') {
+      PrintAggregateUsage();
+      return 1;
+    } else {
+      paths.push_back(arg);
+    }
+  }
+  if (paths.size() == 0 || options.columns.size() == 0) {
+    PrintAggregateUsage();
+    return 1;
+  }
+
+  size_t failures = 0;
+  if (out_name != "") {
+    std::ofstream out_file(out_name);
+    failures = AggregateFiles(paths, options, num_threads, out_file, std::cerr);
+  } else {
+    std::ios::sync_with_stdio(false);
+    failures = AggregateFiles(paths, options, num_threads, std::cout, std::cerr);
+  }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,53 @@
+#include "../default_mode/SymWorld.h"
+#include "../default_mode/Host.h"
+#include "../default_mode/Symbiont.h"
+#include "../default_mode/DataNodes.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/**
+ * Input: Whether births and deaths take the listener-free path, the number of
+ * births to time, and the world's width and height.
+ *
+ * Output: Births per second.
+ *
+ * Purpose: To time host births (each into a neighboring cell of a full grid, so
+ * each also replaces a host) and host deaths, with or without the listener-free path.
+ */
+double TimeBirths(bool quiet, size_t num_births, size_t width, size_t height) {
+  SymConfigBase config;
+  emp::Random random(1);
+  SymWorld world(random, &config);
+  world.SetPopStruct_Grid(width, height, false);
+  if (quiet) world.DetectEventListeners();
+  size_t num_cells = width * height;
+  for (size_t i = 0; i < num_cells; i++) {
+    world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0), emp::WorldPosition(i));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < num_births; i++) {
+    size_t parent = random.GetUInt(num_cells);
+    if (!world.IsOccupied(parent)) continue;
+    world.DoBirth(emp::NewPtr<Host>(&random, &world, &config, 0), parent);
+    if (i % 4 == 0) {
+      size_t dead = random.GetUInt(num_cells);
+      if (world.IsOccupied(dead)) world.DoDeath(dead);
+    }
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return num_births / elapsed.count();
+}
+
+int main(int argc, char * argv[]) {
+  size_t num_births = argc > 1 ? std::stoul(argv[1]) : 2000000;
+  size_t side = argc > 2 ? std::stoul(argv[2]) : 100;
+
+  double general = TimeBirths(false, num_births, side, side);
+  double quiet = TimeBirths(true, num_births, side, side);
+  std::cout << "births/s with signals and hooks: " << general << "\n"
+            << "births/s listener-free:          " << quiet << "\n"
+            << "speedup:                         " << quiet / general << "\n";
+  return 0;
+}
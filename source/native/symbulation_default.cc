@@ -1,6 +1,7 @@
 #include "../default_mode/SymWorld.h"
 #include "../default_mode/WorldSetup.cc"
 #include "../default_mode/DataNodes.h"
+#include "../default_mode/TauLeapWorld.h"
 #include "symbulation.h"
 
 // This is the main function for the NATIVE version of this project.
@@ -10,11 +11,51 @@ int symbulation_main(int argc, char * argv[])
   CheckConfigFile(config, argc, argv);
 
   config.Write(std::cout);
+  if (config.MEAN_FIELD()) return RunMeanField(config);
+  if (config.TAU_LEAP()) {
+    emp::Random random(config.SEED());
+    TauLeapWorld world(random, &config);
+    world.Setup();
+    world.CreateDataFiles();
+    world.RunExperiment();
+    return 0;
+  }
+  if (config.ISLANDS() > 1) {
+    return RunIslands<SymWorld>(config,
+      [](SymWorld & world, SymConfigBase & island_config){ worldSetup(&world, &island_config); },
+      [](SymWorld & world, SymConfigBase & island_config){
+        if(island_config.PHYLOGENY() == 1){
+          std::string file_ending = "_SEED"+std::to_string(island_config.SEED())+".data";
+          world.WritePhylogenyFile(island_config.FILE_PATH()+"Phylogeny_"+island_config.FILE_NAME()+file_ending);
+        }
+      });
+  }
+  if (config.TREATMENTS() != "") {
+    return RunTreatments<SymWorld>(config,
+      [](SymWorld & world, SymConfigBase & treatment_config){ worldSetup(&world, &treatment_config); },
+      [](SymWorld & world, SymConfigBase & treatment_config){
+        if(treatment_config.PHYLOGENY() == 1){
+          std::string file_ending = "_SEED"+std::to_string(treatment_config.SEED())+".data";
+          world.WritePhylogenyFile(treatment_config.FILE_PATH()+"Phylogeny_"+treatment_config.FILE_NAME()+file_ending);
+        }
+      });
+  }
+  if (config.REPLICATES() > 1) {
+    return RunReplicates<SymWorld>(config,
+      [](SymWorld & world, SymConfigBase & rep_config){ worldSetup(&world, &rep_config); },
+      [](SymWorld & world, SymConfigBase & rep_config){
+        if(rep_config.PHYLOGENY() == 1){
+          std::string file_ending = "_SEED"+std::to_string(rep_config.SEED())+".data";
+          world.WritePhylogenyFile(rep_config.FILE_PATH()+"Phylogeny_"+rep_config.FILE_NAME()+file_ending);
+        }
+      });
+  }
   emp::Random random(config.SEED());
 
   SymWorld world(random, &config);
 
   worldSetup(&world, &config);
+  world.ResumeFromCheckpoint();
   world.CreateDateFiles();
   world.RunExperiment();
 
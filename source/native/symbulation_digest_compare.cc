@@ -0,0 +1,34 @@
+#include "../default_mode/WorldDigest.h"
+#include <iostream>
+
+/**
+ * Input: None
+ *
+ * Output: None
+ *
+ * Purpose: To explain how to call symbulation-digest-compare.
+ */
+void PrintDigestCompareUsage() {
+  std::cerr << "Usage: symbulation-digest-compare <digest file> <digest file>\n"
+            << "Compares the world digests of two runs (written with DIGEST_INT set) and reports\n"
+            << "the first update the runs diverge on. Exits with 1 if they diverge.\n";
+}
+
+int main(int argc, char * argv[]) {
+  if (argc != 3) {
+    PrintDigestCompareUsage();
+    return 2;
+  }
+  try {
+    DigestComparison comparison = CompareDigestFiles(argv[1], argv[2]);
+    if (comparison.first_update >= 0) {
+      std::cout << "first diverging update: " << comparison.first_update << std::endl;
+      return 1;
+    }
+    std::cout << "runs agree on all " << comparison.common_updates << " digests they share" << std::endl;
+  } catch (const char * error) {
+    std::cerr << error << std::endl;
+    return 2;
+  }
+  return 0;
+}
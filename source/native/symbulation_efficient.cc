@@ -10,11 +10,24 @@ int symbulation_main(int argc, char * argv[])
   CheckConfigFile(config, argc, argv);
 
   config.Write(std::cout);
+  if (config.ISLANDS() > 1) {
+    return RunIslands<EfficientWorld>(config,
+      [](EfficientWorld & world, SymConfigBase & island_config){ efficientWorldSetup(&world, &island_config); });
+  }
+  if (config.TREATMENTS() != "") {
+    return RunTreatments<EfficientWorld>(config,
+      [](EfficientWorld & world, SymConfigBase & treatment_config){ efficientWorldSetup(&world, &treatment_config); });
+  }
+  if (config.REPLICATES() > 1) {
+    return RunReplicates<EfficientWorld>(config,
+      [](EfficientWorld & world, SymConfigBase & rep_config){ efficientWorldSetup(&world, &rep_config); });
+  }
   emp::Random random(config.SEED());
 
   EfficientWorld world(random, &config);
 
   efficientWorldSetup(&world, &config);
+  world.ResumeFromCheckpoint();
   world.CreateDateFiles();
   world.RunExperiment();
 
@@ -25,11 +25,24 @@ int symbulation_main(int argc, char * argv[])
   LysisCheckConfigFile(config, argc, argv);
 
   config.Write(std::cout);
+  if (config.ISLANDS() > 1) {
+    return RunIslands<LysisWorld>(config,
+      [](LysisWorld & world, SymConfigBase & island_config){ worldSetup(&world, &island_config); });
+  }
+  if (config.TREATMENTS() != "") {
+    return RunTreatments<LysisWorld>(config,
+      [](LysisWorld & world, SymConfigBase & treatment_config){ worldSetup(&world, &treatment_config); });
+  }
+  if (config.REPLICATES() > 1) {
+    return RunReplicates<LysisWorld>(config,
+      [](LysisWorld & world, SymConfigBase & rep_config){ worldSetup(&world, &rep_config); });
+  }
   emp::Random random(config.SEED());
 
   LysisWorld world(random, &config);
 
   worldSetup(&world, &config);
+  world.ResumeFromCheckpoint();
   world.CreateDateFiles();
   world.RunExperiment();
 
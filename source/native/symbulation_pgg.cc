@@ -10,11 +10,24 @@ int symbulation_main(int argc, char * argv[])
   CheckConfigFile(config, argc, argv);
 
   config.Write(std::cout);
+  if (config.ISLANDS() > 1) {
+    return RunIslands<PGGWorld>(config,
+      [](PGGWorld & world, SymConfigBase & island_config){ worldSetup(&world, &island_config); });
+  }
+  if (config.TREATMENTS() != "") {
+    return RunTreatments<PGGWorld>(config,
+      [](PGGWorld & world, SymConfigBase & treatment_config){ worldSetup(&world, &treatment_config); });
+  }
+  if (config.REPLICATES() > 1) {
+    return RunReplicates<PGGWorld>(config,
+      [](PGGWorld & world, SymConfigBase & rep_config){ worldSetup(&world, &rep_config); });
+  }
   emp::Random random(config.SEED());
 
   PGGWorld world(random, &config);
 
   worldSetup(&world, &config);
+  world.ResumeFromCheckpoint();
   world.CreateDateFiles();
   world.RunExperiment();
 
@@ -0,0 +1,47 @@
+#include "../default_mode/SymWorld.h"
+#include "../default_mode/Host.h"
+#include "../default_mode/Symbiont.h"
+#include "../default_mode/DataNodes.h"
+#include "symbulation.h"
+
+/**
+ * Input: None
+ *
+ * Output: None
+ *
+ * Purpose: To explain how to call symbulation-replay.
+ */
+void PrintReplayUsage() {
+  std::cerr << "Usage: symbulation-replay <event log> [-SETTING value ...]\n"
+            << "Rebuilds the population of a run logged with EVENT_LOG set and writes its HostVals,\n"
+            << "SymVals, FreeLivingSyms, HostSymPairs and JointHistograms files (as set in\n"
+            << "SymSettings.cfg and the given settings) without rerunning it. Files are named as\n"
+            << "the run's would be, with _replay added to FILE_NAME.\n";
+}
+
+int main(int argc, char * argv[]) {
+  if (argc < 2 || argv[1][0] == '-') {
+    PrintReplayUsage();
+    return 2;
+  }
+  std::string log_name = argv[1];
+  argv[1] = argv[0];
+  SymConfigBase config;
+  CheckConfigFile(config, argc - 1, argv + 1);
+  try {
+    EventLogReader reader(log_name);
+    config.SEED(reader.GetSeed());
+    config.FILE_NAME(config.FILE_NAME()+"_replay");
+    config.PHYLOGENY(0);
+    emp::Random random(config.SEED());
+    SymWorld world(random, &config);
+    world.Resize(reader.GetNumCells());
+    world.CreateReplayDataFiles();
+    size_t num_events = world.ReplayEventLog(reader, std::max(config.DATA_INT(), 1));
+    std::cout << "replayed " << num_events << " events up to update " << world.GetUpdate() << std::endl;
+  } catch (const char * error) {
+    std::cerr << error << std::endl;
+    return 2;
+  }
+  return 0;
+}
@@ -0,0 +1,26 @@
+#include "../default_mode/RowStream.h"
+#include <iostream>
+#include <string>
+
+// Reference subscriber for a running symbulation's DATA_SOCKET. Prints every frame as
+// "<source>\t<row>" on its own line until the simulation closes the socket. Pass a source
+// name (e.g. a data file name, or raster_host_intval) to only print that source's frames.
+int main(int argc, char * argv[]) {
+  if (argc < 2) {
+    std::cerr << "Usage: symbulation-subscribe <socket path> [source]" << std::endl;
+    return 1;
+  }
+  std::string only_source = argc > 2 ? argv[2] : "";
+
+  RowSubscriber subscriber(argv[1]);
+  if (!subscriber.IsOpen()) {
+    std::cerr << "Could not connect to " << argv[1] << " (is the run using DATA_SOCKET?)" << std::endl;
+    return 1;
+  }
+
+  std::string source, row;
+  while (subscriber.Receive(source, row)) {
+    if (only_source == "" || source == only_source) std::cout << source << "\t" << row << std::endl;
+  }
+  return 0;
+}
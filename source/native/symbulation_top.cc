@@ -0,0 +1,55 @@
+#include "../default_mode/MetricsPage.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+/**
+ * Input: The metrics to show and the stream to show them on.
+ *
+ * Output: None
+ *
+ * Purpose: To print one screen of live run metrics.
+ */
+void PrintMetrics(const MetricsSnapshot & metrics, std::ostream & os){
+  os << "update          " << metrics.update << "\n";
+  os << "updates/sec     " << metrics.updates_per_sec << "\n";
+  os << "hosts           " << metrics.host_count << "\n";
+  os << "symbionts       " << metrics.sym_count << "\n";
+  os << "free symbionts  " << metrics.free_sym_count << "\n";
+  os << "mean host int   " << metrics.mean_host_intval << "\n";
+  os << "mean sym int    " << metrics.mean_sym_intval << "\n";
+  os << "lytic bursts    " << metrics.burst_count << "\n";
+  os << "births avoided  " << metrics.avoided_host_births << " hosts, " << metrics.avoided_sym_births << " symbionts\n";
+  os << "rss (MiB)       " << metrics.rss_bytes / (1024.0 * 1024.0) << std::endl;
+}
+
+// Reads the shared-memory metrics page a running symbulation publishes (see METRICS_SHM)
+// and redraws it once a second. It only ever maps the page read-only, so it never slows
+// the simulation down. Pass -n to print a single snapshot and exit.
+int main(int argc, char * argv[]) {
+  std::string name = "/symbulation";
+  bool once = false;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "-n") once = true;
+    else name = arg;
+  }
+
+  MetricsPage page(name, false);
+  if (!page.IsOpen()) {
+    std::cerr << "No symbulation metrics page named " << name << " (is the run using METRICS_SHM?)" << std::endl;
+    return 1;
+  }
+
+  MetricsSnapshot metrics;
+  while (true) {
+    if (page.Read(metrics)) {
+      if (!once) std::cout << "\033[H\033[J" << "symbulation-top " << name << "\n\n";
+      PrintMetrics(metrics, std::cout);
+    }
+    if (once) break;
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+  }
+  return 0;
+}
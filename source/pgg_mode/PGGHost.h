@@ -69,6 +69,30 @@ public:
     return  "PGGHost";
   }
 
+  /**
+   * Input: The writer of the checkpoint being saved.
+   *
+   * Output: None
+   *
+   * Purpose: To save the PGG host's state, after the host state it inherits, to a checkpoint.
+   */
+  void WriteState(CheckpointWriter & writer) {
+    Host::WriteState(writer);
+    writer.Write(sourcepool);
+  }
+
+  /**
+   * Input: The reader of the checkpoint being loaded.
+   *
+   * Output: None
+   *
+   * Purpose: To restore the PGG host's state saved by WriteState.
+   */
+  void ReadState(CheckpointReader & reader) {
+    Host::ReadState(reader);
+    sourcepool = reader.Read<double>();
+  }
+
   /**
    * Input: None
    *
@@ -151,4 +175,17 @@ public:
 
 };//PGGHost
 
+
+/**
+ * Input: The class name of a host saved in a checkpoint.
+ *
+ * Output: A new host of that class, whose state is then read from the checkpoint.
+ *
+ * Purpose: To recreate PGG hosts when loading a checkpoint.
+ */
+emp::Ptr<Organism> PGGWorld::MakeCheckpointHost(const std::string & name) {
+  if (name == "PGGHost") return emp::NewPtr<PGGHost>(&GetRandom(), this, my_config);
+  return SymWorld::MakeCheckpointHost(name);
+}
+
 #endif
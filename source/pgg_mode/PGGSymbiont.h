@@ -86,6 +86,30 @@ public:
     return  "PGGSymbiont";
   }
 
+  /**
+   * Input: The writer of the checkpoint being saved.
+   *
+   * Output: None
+   *
+   * Purpose: To save the PGG symbiont's state, after the symbiont state it inherits, to a checkpoint.
+   */
+  void WriteState(CheckpointWriter & writer) {
+    Symbiont::WriteState(writer);
+    writer.Write(PGG_donate);
+  }
+
+  /**
+   * Input: The reader of the checkpoint being loaded.
+   *
+   * Output: None
+   *
+   * Purpose: To restore the PGG symbiont's state saved by WriteState.
+   */
+  void ReadState(CheckpointReader & reader) {
+    Symbiont::ReadState(reader);
+    PGG_donate = reader.Read<double>();
+  }
+
   /**
    * Input: None
    *
@@ -175,4 +199,17 @@ public:
     return formattedstring;
   }
 };//PGGSymbiont
+
+/**
+ * Input: The class name of a symbiont saved in a checkpoint.
+ *
+ * Output: A new symbiont of that class, whose state is then read from the checkpoint.
+ *
+ * Purpose: To recreate PGG symbionts when loading a checkpoint.
+ */
+emp::Ptr<Organism> PGGWorld::MakeCheckpointSym(const std::string & name) {
+  if (name == "PGGSymbiont") return emp::NewPtr<PGGSymbiont>(&GetRandom(), this, my_config);
+  return SymWorld::MakeCheckpointSym(name);
+}
+
 #endif
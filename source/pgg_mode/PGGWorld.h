@@ -15,6 +15,10 @@ private:
 public:
   using SymWorld::SymWorld;
 
+  //recreate organisms from checkpoints; defined after the PGGHost and PGGSymbiont classes
+  emp::Ptr<Organism> MakeCheckpointHost(const std::string & name) override;
+  emp::Ptr<Organism> MakeCheckpointSym(const std::string & name) override;
+
   /**
    * Input: None
    *
@@ -97,13 +101,12 @@ public:
     if (!data_node_PGG) {
       data_node_PGG.New();
       OnUpdate([this](size_t){
+        HostedSymTable & table = UseHostedSymTable();
         data_node_PGG->Reset();
         for (size_t i = 0; i< pop.size(); i++) {
           if (IsOccupied(i)) { //track hosted syms
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-            size_t sym_size = syms.size();
-            for(size_t j=0; j< sym_size; j++){
-              data_node_PGG->AddDatum(syms[j]->GetDonation());
+            for(size_t j = table.Begin(i); j < table.End(i); j++){
+              data_node_PGG->AddDatum(table.GetSym(j)->GetDonation());
             }//close for
           }//close if
           if(sym_pop[i]){ //track free-living syms
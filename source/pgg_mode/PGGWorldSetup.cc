@@ -5,6 +5,8 @@
 #include "../ConfigSetup.h"
 #include "PGGHost.h"
 #include "PGGSymbiont.h"
+#include "../default_mode/PopulationFile.h"
+#include "../default_mode/BulkSetup.h"
 
 void worldSetup(emp::Ptr<PGGWorld> world, emp::Ptr<SymConfigBase> my_config) {
 // params
@@ -24,6 +26,18 @@ void worldSetup(emp::Ptr<PGGWorld> world, emp::Ptr<SymConfigBase> my_config) {
 
   if (my_config->GRID() == 0) {world->SetPopStruct_Mixed(false);}
   else world->SetPopStruct_Grid(my_config->GRID_X(), my_config->GRID_Y(), false);
+  world->DetectEventListeners();
+
+  //a population file replaces the hosts and symbionts built below
+  if (SeedPopulationFromFile(world, my_config,
+        [&](double int_val){ return emp::NewPtr<PGGHost>(&random, world, my_config, int_val); },
+        [&](double int_val){ return emp::NewPtr<PGGSymbiont>(&random, world, my_config, int_val, my_config->PGG_DONATE(), 0); })) return;
+  if (my_config->BULK_SETUP()) {
+    BulkPopulationSetup(world, my_config,
+      [&](emp::Random & chunk_random, double int_val){ return emp::NewPtr<PGGHost>(&chunk_random, world, my_config, int_val); },
+      [&](emp::Random & chunk_random, double int_val){ return emp::NewPtr<PGGSymbiont>(&chunk_random, world, my_config, int_val, my_config->PGG_DONATE(), 0); });
+    return;
+  }
 // settings
 
   double comp_host_1 = 0;
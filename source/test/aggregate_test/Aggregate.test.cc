@@ -0,0 +1,62 @@
+#include "../../native/Aggregate.h"
+
+TEST_CASE("ParseRunName", "[aggregate]"){
+  GIVEN("the name of a data file written by a run"){
+    RunInfo info = ParseRunName("Data/VT/HostVals_VT0.5_SEED12.data");
+    THEN("the partner, treatment and rep are read from it"){
+      REQUIRE(info.partner == "Host");
+      REQUIRE(info.treatment == "VT0.5");
+      REQUIRE(info.rep == "12");
+      REQUIRE(info.uid == "VT0.5_12");
+    }
+  }
+  GIVEN("a name that does not follow the data file pattern"){
+    RunInfo info = ParseRunName("results.data");
+    THEN("the whole name is the treatment"){
+      REQUIRE(info.treatment == "results");
+      REQUIRE(info.rep == "0");
+      REQUIRE(info.partner == "NA");
+    }
+  }
+}
+
+TEST_CASE("AggregateBuffer", "[aggregate]"){
+  GIVEN("the contents of a data file"){
+    std::string data = "update,mean_intval,count\n0,0.1,10\n100,0.2,20\n200,0.3,30\n";
+    RunInfo info = ParseRunName("SymVals_t_SEED2.data");
+    AggregateOptions options;
+
+    WHEN("one column is selected"){
+      std::string rows = AggregateBuffer(data.data(), data.size(), info, options);
+      THEN("each update becomes a long-format row"){
+        REQUIRE(rows == "t_2 t 2 0 0.1 Sym\nt_2 t 2 100 0.2 Sym\nt_2 t 2 200 0.3 Sym\n");
+        REQUIRE(AggregateHeader(options) == "uid treatment rep update mean_intval partner\n");
+      }
+    }
+
+    WHEN("only the final update is kept"){
+      options.final_only = true;
+      std::string rows = AggregateBuffer(data.data(), data.size(), info, options);
+      THEN("only the last row is emitted"){
+        REQUIRE(rows == "t_2 t 2 200 0.3 Sym\n");
+      }
+    }
+
+    WHEN("several columns and an update range are selected"){
+      options.columns = {"count", "mean_intval"};
+      options.first_update = 50;
+      options.last_update = 150;
+      std::string rows = AggregateBuffer(data.data(), data.size(), info, options);
+      THEN("each selected column of each update in range becomes a row naming its column"){
+        REQUIRE(rows == "t_2 t 2 100 20 Sym count\nt_2 t 2 100 0.2 Sym mean_intval\n");
+      }
+    }
+
+    WHEN("a column is missing from the file"){
+      options.columns = {"efficiency"};
+      THEN("an exception is thrown"){
+        REQUIRE_THROWS(AggregateBuffer(data.data(), data.size(), info, options));
+      }
+    }
+  }
+}
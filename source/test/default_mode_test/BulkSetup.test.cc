@@ -0,0 +1,89 @@
+#include "../../default_mode/SymWorld.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+#include "../../default_mode/BulkSetup.h"
+#include <set>
+
+TEST_CASE("SampleWithoutReplacement", "[default]"){
+  emp::Random random(5);
+  emp::vector<size_t> picks = SampleWithoutReplacement(random, 100, 60);
+  REQUIRE(picks.size() == 60);
+  REQUIRE(std::set<size_t>(picks.begin(), picks.end()).size() == 60);
+  for (size_t pick : picks) REQUIRE(pick < 100);
+  REQUIRE(SampleWithoutReplacement(random, 10, 20).size() == 10);
+}
+
+TEST_CASE("BulkPopulationSetup", "[default]"){
+  GIVEN("settings for a large world built in bulk"){
+    SymConfigBase config;
+    config.GRID_X(300);
+    config.GRID_Y(200);
+    config.SYM_LIMIT(3);
+    config.START_MOI(1.5);
+    config.HOST_INT(-2);
+    config.SYM_INT(-2);
+
+    auto build = [&config](emp::Random & random){
+      emp::Ptr<SymWorld> world = emp::NewPtr<SymWorld>(random, &config);
+      BulkPopulationSetup(world, &config,
+        [&](emp::Random & chunk_random, double int_val){ return emp::NewPtr<Host>(&chunk_random, world, &config, int_val); },
+        [&](emp::Random & chunk_random, double int_val){ return emp::NewPtr<Symbiont>(&chunk_random, world, &config, int_val); });
+      return world;
+    };
+
+    WHEN("every cell gets a host"){
+      emp::Random random(8);
+      emp::Ptr<SymWorld> world = build(random);
+
+      THEN("no symbiont is lost and symbionts are dealt evenly"){
+        REQUIRE(world->GetSize() == 60000);
+        REQUIRE(world->GetNumOrgs() == 60000);
+        size_t num_syms = 0;
+        size_t num_uneven = 0;
+        for (size_t i = 0; i < world->GetSize(); i++) {
+          size_t host_syms = world->GetOrg(i).GetSymbionts().size();
+          if (host_syms != 1 && host_syms != 2) num_uneven++;
+          num_syms += host_syms;
+        }
+        REQUIRE(num_syms == 90000);
+        REQUIRE(num_uneven == 0);
+      }
+
+      THEN("the same seed builds the same population"){
+        emp::Random other_random(8);
+        emp::Ptr<SymWorld> other = build(other_random);
+        for (size_t i = 0; i < world->GetSize(); i += 997) {
+          REQUIRE(world->GetOrg(i).GetIntVal() == other->GetOrg(i).GetIntVal());
+          REQUIRE(world->GetOrg(i).GetSymbionts().size() == other->GetOrg(i).GetSymbionts().size());
+        }
+        other.Delete();
+      }
+      world.Delete();
+    }
+
+    WHEN("only some cells of a grid get hosts"){
+      config.GRID(1);
+      config.POP_SIZE(1000);
+      emp::Random random(9);
+      emp::Ptr<SymWorld> world = build(random);
+
+      THEN("each host gets its own cell"){
+        REQUIRE(world->GetSize() == 60000);
+        REQUIRE(world->GetNumOrgs() == 1000);
+      }
+      world.Delete();
+    }
+
+    WHEN("symbionts are free-living"){
+      config.FREE_LIVING_SYMS(1);
+      config.START_MOI(0.5);
+      emp::Random random(10);
+      emp::Ptr<SymWorld> world = build(random);
+
+      THEN("each symbiont gets its own cell"){
+        REQUIRE(world->GetNumOrgs() == 60000 + 30000);
+      }
+      world.Delete();
+    }
+  }
+}
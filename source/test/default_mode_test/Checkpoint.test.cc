@@ -0,0 +1,120 @@
+#include "../../default_mode/SymWorld.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+#include "../../lysis_mode/LysisWorld.h"
+#include "../../lysis_mode/Bacterium.h"
+#include "../../lysis_mode/Phage.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+std::string ReadCheckpointTestFile(const std::string & filename) {
+  std::ifstream in(filename, std::ios::binary);
+  std::stringstream contents;
+  contents << in.rdbuf();
+  return contents.str();
+}
+
+TEST_CASE("Checkpoint and restore", "[default]"){
+  GIVEN("a world of hosts with symbionts that has run for a while"){
+    emp::Random random(23);
+    SymConfigBase config;
+    config.SYM_LIMIT(3);
+    config.HORIZ_TRANS(1);
+    config.MUTATION_SIZE(0.1);
+    config.FILE_PATH("CheckpointTest");
+    int world_size = 40;
+    size_t num_updates = 15;
+
+    SymWorld world(random, &config);
+    world.Resize(world_size);
+    for (int i = 0; i < world_size / 2; i++) {
+      emp::Ptr<Organism> host = emp::NewPtr<Host>(&random, &world, &config, random.GetDouble(-1, 1));
+      host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, random.GetDouble(-1, 1)));
+      world.AddOrgAt(host, emp::WorldPosition(i * 2, 0));
+    }
+    for (size_t i = 0; i < num_updates; i++) world.Update();
+
+    WHEN("a checkpoint is restored into a new world with a different seed"){
+      world.SaveCheckpoint("CheckpointTestA.bin");
+      emp::Random other_random(99);
+      SymWorld restored(other_random, &config);
+      restored.Resize(world_size);
+      restored.LoadCheckpoint("CheckpointTestA.bin");
+
+      THEN("it continues exactly as the original does"){
+        REQUIRE(restored.GetUpdate() == world.GetUpdate());
+        REQUIRE(restored.GetNumOrgs() == world.GetNumOrgs());
+        for (size_t i = 0; i < num_updates; i++) {
+          world.Update();
+          restored.Update();
+        }
+        world.SaveCheckpoint("CheckpointTestA2.bin");
+        restored.SaveCheckpoint("CheckpointTestB2.bin");
+        REQUIRE(ReadCheckpointTestFile("CheckpointTestA2.bin") == ReadCheckpointTestFile("CheckpointTestB2.bin"));
+      }
+
+      std::remove("CheckpointTestA.bin");
+      std::remove("CheckpointTestA2.bin");
+      std::remove("CheckpointTestB2.bin");
+    }
+
+    WHEN("a checkpoint file is cut short"){
+      world.SaveCheckpoint("CheckpointTestA.bin");
+      std::string contents = ReadCheckpointTestFile("CheckpointTestA.bin");
+      std::ofstream("CheckpointTestA.bin", std::ios::binary) << contents.substr(0, contents.size() / 2);
+      SymWorld restored(random, &config);
+      restored.Resize(world_size);
+
+      THEN("loading it throws"){
+        REQUIRE_THROWS(restored.LoadCheckpoint("CheckpointTestA.bin"));
+      }
+      std::remove("CheckpointTestA.bin");
+    }
+  }
+}
+
+TEST_CASE("Checkpoint and restore in lysis mode", "[lysis]"){
+  GIVEN("a lysis world of bacteria with phage that has run for a while"){
+    emp::Random random(31);
+    SymConfigBase config;
+    config.LYSIS(1);
+    config.LYSIS_CHANCE(0.5);
+    config.BURST_TIME(3);
+    config.SYM_LIMIT(4);
+    config.FILE_PATH("CheckpointTest");
+    int world_size = 40;
+    size_t num_updates = 12;
+
+    LysisWorld world(random, &config);
+    world.Resize(world_size);
+    for (int i = 0; i < world_size / 2; i++) {
+      emp::Ptr<Organism> host = emp::NewPtr<Bacterium>(&random, &world, &config, random.GetDouble(-1, 1));
+      host->AddSymbiont(emp::NewPtr<Phage>(&random, &world, &config, random.GetDouble(-1, 1)));
+      world.AddOrgAt(host, emp::WorldPosition(i * 2, 0));
+    }
+    for (size_t i = 0; i < num_updates; i++) world.Update();
+
+    WHEN("a checkpoint is restored into a new world"){
+      world.SaveCheckpoint("CheckpointTestLysisA.bin");
+      emp::Random other_random(5);
+      LysisWorld restored(other_random, &config);
+      restored.Resize(world_size);
+      restored.LoadCheckpoint("CheckpointTestLysisA.bin");
+
+      THEN("it continues exactly as the original does"){
+        for (size_t i = 0; i < num_updates; i++) {
+          world.Update();
+          restored.Update();
+        }
+        world.SaveCheckpoint("CheckpointTestLysisA2.bin");
+        restored.SaveCheckpoint("CheckpointTestLysisB2.bin");
+        REQUIRE(ReadCheckpointTestFile("CheckpointTestLysisA2.bin") == ReadCheckpointTestFile("CheckpointTestLysisB2.bin"));
+      }
+
+      std::remove("CheckpointTestLysisA.bin");
+      std::remove("CheckpointTestLysisA2.bin");
+      std::remove("CheckpointTestLysisB2.bin");
+    }
+  }
+}
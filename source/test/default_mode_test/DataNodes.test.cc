@@ -593,7 +593,7 @@ TEST_CASE("GetHorizontalTransmissionAttemptCount", "[default]"){
     world.Resize(world_size);
     config.SYM_HORIZ_TRANS_RES(0);
 
-    emp::DataMonitor<int>& data_node_attempts_horiztrans = world.GetHorizontalTransmissionAttemptCount();
+    EventCounter& data_node_attempts_horiztrans = world.GetHorizontalTransmissionAttemptCount();
     emp::WorldPosition parent_pos = emp::WorldPosition(0, 0);
     REQUIRE(data_node_attempts_horiztrans.GetTotal() == 0);
 
@@ -657,7 +657,7 @@ TEST_CASE("GetHorizontalTransmissionSuccessCount", "[default]"){
     world.Resize(world_size);
     config.SYM_HORIZ_TRANS_RES(0);
 
-    emp::DataMonitor<int>& data_node_successes_horiztrans = world.GetHorizontalTransmissionSuccessCount();
+    EventCounter& data_node_successes_horiztrans = world.GetHorizontalTransmissionSuccessCount();
     emp::WorldPosition parent_pos = emp::WorldPosition(0, 0);
     REQUIRE(data_node_successes_horiztrans.GetTotal() == 0);
 
@@ -722,7 +722,7 @@ TEST_CASE("GetVerticalTransmissionAttemptCount", "[default]"){
     config.SYM_VERT_TRANS_RES(0);
     config.VERTICAL_TRANSMISSION(1);
 
-    emp::DataMonitor<int>& data_node_attempts_verttrans = world.GetVerticalTransmissionAttemptCount();
+    EventCounter& data_node_attempts_verttrans = world.GetVerticalTransmissionAttemptCount();
     REQUIRE(data_node_attempts_verttrans.GetTotal() == 0);
 
     WHEN("A symbiont baby gets vertically transmitted into a host baby"){
@@ -741,3 +741,144 @@ TEST_CASE("GetVerticalTransmissionAttemptCount", "[default]"){
     }
   }
 }
+
+TEST_CASE("GetAvoidedSymBirthCount", "[default]"){
+  GIVEN( "a world" ) {
+    emp::Random random(17);
+    SymConfigBase config;
+    int int_val = 0;
+    SymWorld world(random, &config);
+    world.Resize(4);
+    config.SYM_HORIZ_TRANS_RES(0);
+    config.FREE_LIVING_SYMS(0);
+
+    EventCounter& data_node_avoided_sym_births = world.GetAvoidedSymBirthCount();
+    emp::Ptr<Symbiont> symbiont = emp::NewPtr<Symbiont>(&random, &world, &config, int_val);
+    emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, int_val);
+    world.AddOrgAt(host, 1);
+    REQUIRE(data_node_avoided_sym_births.GetTotal() == 0);
+
+    WHEN("A symbiont's offspring would be killed trying to get into a full host"){
+      config.SYM_LIMIT(0);
+      symbiont->HorizontalTransmission(emp::WorldPosition(0, 0));
+
+      THEN("No offspring is made and the avoided birth is counted"){
+        REQUIRE(host->HasSym() == false);
+        REQUIRE(world.GetHorizontalTransmissionAttemptCount().GetTotal() == 1);
+        REQUIRE(world.GetHorizontalTransmissionSuccessCount().GetTotal() == 0);
+        REQUIRE(data_node_avoided_sym_births.GetTotal() == 1);
+      }
+    }
+    WHEN("A symbiont's offspring gets into a host"){
+      config.SYM_LIMIT(1);
+      symbiont->HorizontalTransmission(emp::WorldPosition(0, 0));
+
+      THEN("No avoided birth is counted"){
+        REQUIRE(host->GetSymbionts().size() == 1);
+        REQUIRE(data_node_avoided_sym_births.GetTotal() == 0);
+      }
+    }
+    symbiont.Delete();
+  }
+}
+
+TEST_CASE("GetAvoidedHostBirthCount", "[default]"){
+  GIVEN( "a world with room for one host" ) {
+    emp::Random random(17);
+    SymConfigBase config;
+    int int_val = 0;
+    SymWorld world(random, &config);
+    world.Resize(1);
+    config.HOST_REPRO_RES(10);
+
+    EventCounter& data_node_avoided_host_births = world.GetAvoidedHostBirthCount();
+    emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, int_val);
+    world.AddOrgAt(host, 0);
+    REQUIRE(data_node_avoided_host_births.GetTotal() == 0);
+
+    WHEN("The host has enough points to reproduce"){
+      host->SetPoints(20);
+      host->Process(emp::WorldPosition(0));
+
+      THEN("Its offspring, which could only land on it, is not made and the avoided birth is counted"){
+        REQUIRE(world.GetNumOrgs() == 1);
+        REQUIRE(world.GetPop()[0] == host);
+        REQUIRE(host->GetPoints() == 0);
+        REQUIRE(data_node_avoided_host_births.GetTotal() == 1);
+      }
+    }
+  }
+}
+
+TEST_CASE("AddJointHistogram", "[default]"){
+  GIVEN( "a world" ) {
+    emp::Random random(17);
+    SymConfigBase config;
+    SymWorld world(random, &config);
+    world.Resize(4);
+    config.SYM_LIMIT(3);
+
+    WHEN("two joint histograms of symbiont traits are added"){
+      JointHistogram & int_infect = world.AddJointHistogram("int_val", "infection_chance", 2);
+      JointHistogram & infect_int = world.AddJointHistogram("infection_chance", "int_val", 2);
+
+      emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0);
+      emp::Ptr<Symbiont> sym = emp::NewPtr<Symbiont>(&random, &world, &config, -0.5);
+      sym->SetInfectionChance(0.75);
+      host->AddSymbiont(sym);
+      world.AddOrgAt(host, 0);
+      world.Update();
+
+      THEN("both are filled from the same symbionts"){
+        REQUIRE(int_infect.GetCount(0, 1) == 1);
+        REQUIRE(int_infect.GetCount(1, 0) == 0);
+        REQUIRE(infect_int.GetCount(1, 0) == 1);
+        REQUIRE(world.GetJointHistograms().size() == 2);
+      }
+    }
+
+    WHEN("an unknown trait is requested"){
+      THEN("an exception is thrown"){
+        REQUIRE_THROWS(world.AddJointHistogram("int_val", "wingspan", 2));
+      }
+    }
+  }
+}
+
+TEST_CASE("GetIntValPairDataNode", "[default]"){
+  GIVEN( "a world" ) {
+    emp::Random random(17);
+    SymConfigBase config;
+    SymWorld world(random, &config);
+    world.Resize(4);
+    config.SYM_LIMIT(2);
+
+    PairStats & pairs = world.GetIntValPairDataNode();
+    REQUIRE(pairs.GetCount() == 0);
+    REQUIRE(std::isnan(pairs.GetCorrelation()));
+
+    WHEN("hosts hold symbionts with interaction values offset from their own"){
+      double host_int_vals[3] = {-0.5, 0.0, 0.5};
+      for(size_t i = 0; i < 3; i++){
+        emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, host_int_vals[i]);
+        host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, host_int_vals[i] + 0.25));
+        host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, host_int_vals[i] + 0.45));
+        world.AddOrgAt(host, i);
+      }
+      world.Update();
+
+      THEN("every host-symbiont pair is counted and the traits are correlated"){
+        double expected_correlation = sqrt((1.0/6) / (1.0/6 + 0.01)); //offsets add variance 0.01
+        REQUIRE(pairs.GetCount() == 6);
+        REQUIRE(pairs.GetCorrelation() > (expected_correlation - 0.0001));
+        REQUIRE(pairs.GetCorrelation() < (expected_correlation + 0.0001));
+        REQUIRE(pairs.GetCovariance() > (1.0/6 - 0.0001));
+        REQUIRE(pairs.GetCovariance() < (1.0/6 + 0.0001));
+        REQUIRE(pairs.GetMismatchDataNode().GetMean() > 0.3499);
+        REQUIRE(pairs.GetMismatchDataNode().GetMean() < 0.3501);
+        REQUIRE(pairs.GetMismatchDataNode().GetHistCount(2) == 3);
+        REQUIRE(pairs.GetMismatchDataNode().GetHistCount(4) == 3);
+      }
+    }
+  }
+}
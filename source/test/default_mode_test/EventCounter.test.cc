@@ -0,0 +1,74 @@
+#include "../../default_mode/EventCounter.h"
+#include <thread>
+
+TEST_CASE("EventCounter", "[default]"){
+  GIVEN("an empty event counter"){
+    EventCounter counter;
+    REQUIRE(counter.GetCount() == 0);
+    REQUIRE(counter.GetTotal() == 0);
+    REQUIRE(std::isnan(counter.GetMean()));
+
+    WHEN("events are added"){
+      counter.AddDatum();
+      counter.AddDatum(4);
+      counter.AddDatum(7);
+
+      THEN("the count, total, and mean reflect them"){
+        REQUIRE(counter.GetCount() == 3);
+        REQUIRE(counter.GetTotal() == 12);
+        REQUIRE(counter.GetMean() == 4);
+      }
+
+      THEN("marking them reported closes them off for a data file row"){
+        counter.MarkReported();
+        counter.AddDatum(5);
+        REQUIRE(counter.GetLastReportCount() == 3);
+        REQUIRE(counter.GetLastReportTotal() == 12);
+        REQUIRE(counter.GetUnreportedTotal() == 5);
+        counter.MarkReported();
+        REQUIRE(counter.GetLastReportCount() == 1);
+        REQUIRE(counter.GetLastReportTotal() == 5);
+      }
+
+      THEN("resetting clears them"){
+        counter.Reset();
+        REQUIRE(counter.GetCount() == 0);
+        REQUIRE(counter.GetTotal() == 0);
+      }
+    }
+
+    WHEN("several threads add events at once"){
+      size_t num_threads = 4;
+      size_t events_per_thread = 10000;
+      emp::vector<std::thread> threads;
+      for(size_t i = 0; i < num_threads; i++){
+        threads.emplace_back([&counter, events_per_thread](){
+          for(size_t j = 0; j < events_per_thread; j++) counter.AddDatum(2);
+        });
+      }
+      for(std::thread & thread : threads) thread.join();
+
+      THEN("no events are lost"){
+        REQUIRE(counter.GetCount() == num_threads * events_per_thread);
+        REQUIRE(counter.GetTotal() == 2 * num_threads * events_per_thread);
+      }
+    }
+
+    WHEN("more threads than shards add events at once"){
+      size_t num_threads = EventCounter::NUM_SHARDS + 8;
+      size_t events_per_thread = 2000;
+      emp::vector<std::thread> threads;
+      for(size_t i = 0; i < num_threads; i++){
+        threads.emplace_back([&counter, events_per_thread](){
+          for(size_t j = 0; j < events_per_thread; j++) counter.AddDatum(3);
+        });
+      }
+      for(std::thread & thread : threads) thread.join();
+
+      THEN("threads sharing a shard lose no events"){
+        REQUIRE(counter.GetCount() == num_threads * events_per_thread);
+        REQUIRE(counter.GetTotal() == 3 * num_threads * events_per_thread);
+      }
+    }
+  }
+}
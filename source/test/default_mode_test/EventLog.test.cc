@@ -0,0 +1,124 @@
+#include "../../default_mode/SymWorld.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+#include "../../default_mode/DataNodes.h"
+#include "../../default_mode/EventLog.h"
+#include <cstdio>
+
+TEST_CASE("Event log writer and reader", "[default]"){
+  SymConfigBase config;
+  emp::Random random(5);
+  SymWorld world(random, &config);
+  emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, -0.25);
+  host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0.5));
+  emp::Ptr<Symbiont> sym = emp::NewPtr<Symbiont>(&random, &world, &config, 0.75);
+  sym->SetInfectionChance(0.125);
+
+  {
+    EventLogWriter writer("EventLogTest.bin", 42, 100000, 7);
+    writer.HostPlaced(99999, -1, *host);
+    writer.FreeSymPlaced(3, 99999, *sym);
+    writer.StartMove(3);
+    writer.FreeSymPlaced(4, 3, *sym);
+    writer.StartMove(4);
+    writer.EndMove();
+    writer.Update(300);
+  }
+
+  EventLogReader reader("EventLogTest.bin");
+  REQUIRE(reader.GetSeed() == 42);
+  REQUIRE(reader.GetNumCells() == 100000);
+  REQUIRE(reader.GetStartUpdate() == 7);
+  LoggedEvent event;
+  REQUIRE(reader.Next(event));
+  REQUIRE(event.kind == LogEvent::HOST_PLACED);
+  REQUIRE(event.cell == 99999);
+  REQUIRE(event.other == 0);
+  REQUIRE(event.traits.int_val == -0.25);
+  REQUIRE(event.syms.size() == 1);
+  REQUIRE(event.syms[0].int_val == 0.5);
+  REQUIRE(event.syms[0].infection_chance == config.SYM_INFECTION_CHANCE());
+  REQUIRE(reader.Next(event));
+  REQUIRE(event.kind == LogEvent::FREE_SYM_PLACED);
+  REQUIRE(event.other == 100000);
+  REQUIRE(event.traits.infection_chance == 0.125);
+  REQUIRE(reader.Next(event));
+  REQUIRE(event.kind == LogEvent::FREE_SYM_MOVED);
+  REQUIRE(event.cell == 3);
+  REQUIRE(event.other == 4);
+  REQUIRE(reader.Next(event));
+  REQUIRE(event.kind == LogEvent::FREE_SYM_DIED);
+  REQUIRE(event.cell == 4);
+  REQUIRE(reader.Next(event));
+  REQUIRE(event.kind == LogEvent::UPDATE);
+  REQUIRE(event.cell == 300);
+  REQUIRE(!reader.Next(event));
+
+  host.Delete();
+  sym.Delete();
+  std::remove("EventLogTest.bin");
+  REQUIRE_THROWS(EventLogReader("EventLogTest.bin"));
+}
+
+TEST_CASE("Replaying an event log", "[default]"){
+  GIVEN("a logged run with hosted and free-living symbionts"){
+    SymConfigBase config;
+    config.SYM_LIMIT(3);
+    config.FREE_LIVING_SYMS(1);
+    config.ECTOSYMBIOSIS(1);
+    config.MOVE_FREE_SYMS(1);
+    config.MUTATION_SIZE(0.05);
+    config.HOST_AGE_MAX(30);
+    config.SYM_AGE_MAX(20);
+    emp::Random random(17);
+    SymWorld world(random, &config);
+    world.Resize(20, 20);
+    for (size_t i = 0; i < world.GetSize(); i++) {
+      emp::Ptr<Organism> host = emp::NewPtr<Host>(&random, &world, &config, random.GetDouble(-1, 1));
+      if (i % 2 == 0) host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, random.GetDouble(-1, 1)));
+      world.AddOrgAt(host, emp::WorldPosition(i));
+      if (i % 3 == 0) world.AddOrgAt(emp::NewPtr<Symbiont>(&random, &world, &config, random.GetDouble(-1, 1)), emp::WorldPosition(0, i));
+    }
+    world.StartEventLog("EventLogReplayTest.bin");
+    for (int i = 0; i < 60; i++) world.Update();
+    world.FlushEventLog();
+
+    WHEN("it is replayed into an empty world"){
+      emp::Random replay_random(1);
+      SymWorld replay(replay_random, &config);
+      EventLogReader reader("EventLogReplayTest.bin");
+      size_t num_updates = 0;
+      size_t num_births = 0;
+      replay.ReplayEventLog(reader, 1, [&](const LoggedEvent & event){
+        if (event.kind == LogEvent::UPDATE) num_updates++;
+        if (event.kind == LogEvent::HOST_PLACED && event.other > 0) num_births++;
+      });
+
+      THEN("it ends with the run's population, update and traits"){
+        REQUIRE(num_updates == 60);
+        REQUIRE(num_births > 0);
+        REQUIRE(replay.GetUpdate() == world.GetUpdate());
+        REQUIRE(replay.GetNumOrgs() == world.GetNumOrgs());
+        size_t num_different = 0;
+        for (size_t i = 0; i < world.GetSize(); i++) {
+          if (world.IsOccupied(i) != replay.IsOccupied(i)) num_different++;
+          else if (world.IsOccupied(i)) {
+            emp::vector<emp::Ptr<Organism>> & syms = world.GetOrg(i).GetSymbionts();
+            emp::vector<emp::Ptr<Organism>> & replayed_syms = replay.GetOrg(i).GetSymbionts();
+            if (world.GetOrg(i).GetIntVal() != replay.GetOrg(i).GetIntVal()) num_different++;
+            if (syms.size() != replayed_syms.size()) num_different++;
+            else for (size_t j = 0; j < syms.size(); j++) {
+              if (syms[j]->GetIntVal() != replayed_syms[j]->GetIntVal()) num_different++;
+            }
+          }
+          emp::Ptr<Organism> sym = world.GetSymAt(i);
+          emp::Ptr<Organism> replayed_sym = replay.GetSymAt(i);
+          if ((bool) sym != (bool) replayed_sym) num_different++;
+          else if (sym && (sym->GetIntVal() != replayed_sym->GetIntVal() || sym->GetInfectionChance() != replayed_sym->GetInfectionChance())) num_different++;
+        }
+        REQUIRE(num_different == 0);
+      }
+    }
+    std::remove("EventLogReplayTest.bin");
+  }
+}
@@ -502,3 +502,83 @@ TEST_CASE("AddSymbiont", "[default]"){
   }
   host.Delete();
 }
+
+TEST_CASE("RemoveDeadSymbionts", "[default]"){
+  emp::Random random(17);
+  SymConfigBase config;
+  config.SYM_LIMIT(4);
+  config.HORIZ_TRANS(0);
+  SymWorld world(random, &config);
+  world.Resize(1);
+  double int_val = 0;
+  emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, int_val);
+  world.AddOrgAt(host, 0);
+  emp::Ptr<Organism> syms[4];
+  for (size_t i = 0; i < 4; i++) {
+    syms[i] = emp::NewPtr<Symbiont>(&random, &world, &config, int_val);
+    host->AddSymbiont(syms[i]);
+  }
+
+  WHEN("some of a host's symbionts are dead when it is processed"){
+    syms[0]->SetDead();
+    syms[2]->SetDead();
+    host->Process(emp::WorldPosition(0));
+
+    THEN("the living symbionts are all processed and kept in order"){
+      emp::vector<emp::Ptr<Organism>>& host_syms = host->GetSymbionts();
+      REQUIRE(host_syms.size() == 2);
+      REQUIRE(host_syms[0] == syms[1]);
+      REQUIRE(host_syms[1] == syms[3]);
+      REQUIRE(syms[1]->GetAge() == 1);
+      REQUIRE(syms[3]->GetAge() == 1);
+    }
+    THEN("the dead symbionts are destroyed at the end of the update"){
+      REQUIRE(world.GetGraveyardSize() == 2);
+      world.Update();
+      REQUIRE(world.GetGraveyardSize() == 0);
+    }
+  }
+}
+
+TEST_CASE("Host reproduction signals and custom birth functions", "[default]"){
+  GIVEN("a host with enough points to reproduce"){
+    emp::Random random(17);
+    SymConfigBase config;
+    config.HOST_REPRO_RES(10);
+    SymWorld world(random, &config);
+    world.Resize(2);
+    emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0.5);
+    world.AddOrgAt(host, 0);
+    host->SetPoints(20);
+
+    WHEN("something listens for hosts about to reproduce"){
+      double points_before_repro = -1;
+      world.OnBeforeRepro([&](size_t){ points_before_repro = host->GetPoints(); });
+      world.DetectEventListeners();
+      world.SetAddBirthFun([](emp::Ptr<Organism>, emp::WorldPosition){ return emp::WorldPosition(1); });
+      host->Process(emp::WorldPosition(0));
+
+      THEN("it sees the parent before the offspring is made"){
+        REQUIRE(points_before_repro >= 20);
+        REQUIRE(host->GetPoints() == 0);
+      }
+    }
+    WHEN("the world's birth function reads the offspring to place it"){
+      double placed_int_val = -2;
+      world.SetAddBirthFun([&](emp::Ptr<Organism> offspring, emp::WorldPosition){
+        placed_int_val = offspring->GetIntVal();
+        return emp::WorldPosition(1);
+      });
+      host->Process(emp::WorldPosition(0));
+
+      THEN("the offspring is made before it is placed"){
+        REQUIRE(world.IsOccupied(1));
+        REQUIRE(placed_int_val == world.GetOrg(1).GetIntVal());
+        REQUIRE(world.GetAvoidedHostBirthCount().GetTotal() == 0);
+      }
+      THEN("the world cannot place offspring before they are made"){
+        REQUIRE_THROWS(world.FindBirthPos(emp::WorldPosition(0)));
+      }
+    }
+  }
+}
@@ -0,0 +1,123 @@
+#include "../../default_mode/SymWorld.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+
+// A world that never takes the host-only kernel, to compare against
+class FullKernelWorld : public SymWorld {
+public:
+  FullKernelWorld(emp::Random & _random, emp::Ptr<SymConfigBase> _config) : SymWorld(_random, _config) {}
+  void Update() {
+    host_only = false;
+    SymWorld::Update();
+  }
+};
+
+TEST_CASE("Host-only update kernel", "[default]"){
+  GIVEN("a world of hosts without symbionts"){
+    SymConfigBase config;
+    config.HOST_AGE_MAX(40);
+    config.MUTATION_SIZE(0.05);
+    config.LIMITED_RES_TOTAL(20000);
+    config.LIMITED_RES_INFLOW(10000);
+
+    auto fill = [&config](emp::Random & random, SymWorld & world){
+      world.Resize(20, 20);
+      for (size_t i = 0; i < world.GetSize(); i += 2) {
+        world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, random.GetDouble(-1, 1)), emp::WorldPosition(i));
+      }
+    };
+    emp::Random random(7);
+    SymWorld world(random, &config);
+    fill(random, world);
+
+    THEN("it switches to the host-only kernel after its first update"){
+      REQUIRE(!world.IsHostOnly());
+      world.Update();
+      REQUIRE(world.IsHostOnly());
+    }
+
+    THEN("the host-only kernel gives the same population as the full one"){
+      emp::Random other_random(7);
+      FullKernelWorld other(other_random, &config);
+      fill(other_random, other);
+      for (size_t update = 0; update < 100; update++) {
+        world.Update();
+        other.Update();
+      }
+      REQUIRE(world.IsHostOnly());
+      REQUIRE(world.GetNumOrgs() > 0);
+      REQUIRE(world.GetNumOrgs() == other.GetNumOrgs());
+      size_t num_different = 0;
+      for (size_t i = 0; i < world.GetSize(); i++) {
+        if (world.IsOccupied(i) != other.IsOccupied(i)) num_different++;
+        else if (world.IsOccupied(i) && (world.GetOrg(i).GetIntVal() != other.GetOrg(i).GetIntVal()
+          || world.GetOrg(i).GetPoints() != other.GetOrg(i).GetPoints())) num_different++;
+      }
+      REQUIRE(num_different == 0);
+    }
+
+    WHEN("a symbiont is injected"){
+      world.Update();
+      world.InjectSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0.5));
+      THEN("the world goes back to the full kernel"){
+        REQUIRE(!world.IsHostOnly());
+        world.Update();
+        REQUIRE(!world.IsHostOnly());
+      }
+    }
+
+    WHEN("a free-living symbiont arrives"){
+      config.FREE_LIVING_SYMS(1);
+      world.Update();
+      world.AddOrgAt(emp::NewPtr<Symbiont>(&random, &world, &config, 0.5), emp::WorldPosition(0, 1));
+      THEN("the world goes back to the full kernel"){
+        REQUIRE(!world.IsHostOnly());
+      }
+    }
+  }
+
+  GIVEN("a world whose last symbiont dies"){
+    SymConfigBase config;
+    config.SYM_AGE_MAX(3);
+    config.HORIZ_TRANS(0);
+    config.VERTICAL_TRANSMISSION(0);
+    emp::Random random(9);
+    SymWorld world(random, &config);
+    world.Resize(10, 10);
+    emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0.5);
+    host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0.5));
+    world.AddOrgAt(host, emp::WorldPosition(0));
+
+    THEN("the world switches to the host-only kernel once it is gone"){
+      world.Update();
+      REQUIRE(!world.IsHostOnly());
+      for (size_t update = 0; update < 10; update++) world.Update();
+      REQUIRE(world.GetNumLiveSymbionts() == 0);
+      REQUIRE(world.IsHostOnly());
+    }
+  }
+
+  GIVEN("symbionts made, copied and destroyed in a world"){
+    SymConfigBase config;
+    emp::Random random(11);
+    SymWorld world(random, &config);
+    world.Resize(10, 10);
+    REQUIRE(world.GetNumLiveSymbionts() == 0);
+
+    emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0.5);
+    emp::Ptr<Symbiont> sym = emp::NewPtr<Symbiont>(&random, &world, &config, 0.5);
+    host->AddSymbiont(sym);
+    world.AddOrgAt(host, emp::WorldPosition(0));
+    emp::Ptr<Symbiont> copy = emp::NewPtr<Symbiont>(*sym);
+
+    THEN("the world counts each one while it exists"){
+      REQUIRE(world.GetNumLiveSymbionts() == 2);
+      copy.Delete();
+      REQUIRE(world.GetNumLiveSymbionts() == 1);
+      world.DoDeath(0);
+      world.Update();
+      REQUIRE(world.GetNumLiveSymbionts() == 0);
+      REQUIRE(world.IsHostOnly());
+    }
+  }
+}
@@ -0,0 +1,110 @@
+#include "../../default_mode/SymWorld.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+#include "../../default_mode/HostedSymTable.h"
+
+TEST_CASE("HostedSymTable Build", "[default]"){
+  GIVEN("hosts with zero, two and one symbionts and an empty cell"){
+    SymConfigBase config;
+    config.SYM_LIMIT(3);
+    emp::Random random(7);
+    SymWorld world(random, &config);
+    world.Resize(4, 1);
+
+    emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0.1);
+    world.AddOrgAt(host, emp::WorldPosition(0));
+    host = emp::NewPtr<Host>(&random, &world, &config, 0.2);
+    emp::Ptr<Symbiont> first = emp::NewPtr<Symbiont>(&random, &world, &config, -0.5);
+    first->SetInfectionChance(0.25);
+    host->AddSymbiont(first);
+    host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0.5));
+    world.AddOrgAt(host, emp::WorldPosition(1));
+    host = emp::NewPtr<Host>(&random, &world, &config, 0.3);
+    host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0.75));
+    world.AddOrgAt(host, emp::WorldPosition(3));
+
+    HostedSymTable table;
+    table.Build(world.GetPop(), 0);
+
+    THEN("each host's symbionts are a run of rows, in cell and symbiont order"){
+      REQUIRE(table.GetNumCells() == 4);
+      REQUIRE(table.GetNumSyms() == 3);
+      REQUIRE(table.GetCount(0) == 0);
+      REQUIRE(table.GetCount(1) == 2);
+      REQUIRE(table.GetCount(2) == 0);
+      REQUIRE(table.GetCount(3) == 1);
+      REQUIRE(table.Begin(1) == 0);
+      REQUIRE(table.End(3) == 3);
+      REQUIRE(table.GetSym(0) == first);
+      REQUIRE(table.GetIntVal(0) == -0.5);
+      REQUIRE(table.GetInfectionChance(0) == 0.25);
+      REQUIRE(table.GetIntVal(1) == 0.5);
+      REQUIRE(table.GetIntVal(2) == 0.75);
+    }
+
+    WHEN("a host loses its symbionts and the table is rebuilt"){
+      world.GetOrg(1).ClearSyms();
+      first.Delete();
+      table.Build(world.GetPop(), 0);
+      THEN("only the remaining symbiont is left"){
+        REQUIRE(table.GetNumSyms() == 1);
+        REQUIRE(table.GetCount(1) == 0);
+        REQUIRE(table.Begin(3) == 0);
+        REQUIRE(table.GetIntVal(0) == 0.75);
+      }
+    }
+  }
+}
+
+TEST_CASE("Data nodes read the hosted symbiont table", "[default]"){
+  GIVEN("a running world with several symbionts per host"){
+    SymConfigBase config;
+    config.SYM_LIMIT(5);
+    config.HORIZ_TRANS(1);
+    config.MUTATION_SIZE(0.05);
+    emp::Random random(13);
+    SymWorld world(random, &config);
+    world.Resize(10, 10);
+    for (size_t i = 0; i < world.GetSize(); i++) {
+      emp::Ptr<Organism> host = emp::NewPtr<Host>(&random, &world, &config, random.GetDouble(-1, 1));
+      for (size_t j = 0; j < i % 4; j++) host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, random.GetDouble(-1, 1)));
+      world.AddOrgAt(host, emp::WorldPosition(i));
+    }
+    emp::DataMonitor<double, emp::data::Histogram> & node = world.GetHostedSymIntValDataNode();
+    emp::DataMonitor<int> & counts = world.GetCountHostedSymsDataNode();
+    for (int i = 0; i < 20; i++) world.Update();
+
+    THEN("they match a scan of the hosts' own symbionts taken before the update"){
+      emp::DataMonitor<double, emp::data::Histogram> expected;
+      expected.SetupBins(-1.0, 1.1, 21);
+      size_t num_syms = 0;
+      for (size_t i = 0; i < world.GetSize(); i++) {
+        if (!world.IsOccupied(i)) continue;
+        for (emp::Ptr<Organism> sym : world.GetOrg(i).GetSymbionts()) {
+          expected.AddDatum(sym->GetIntVal());
+          num_syms++;
+        }
+      }
+      world.Update(); //fills the nodes from the population scanned above
+      REQUIRE(num_syms > 0);
+      REQUIRE(node.GetCount() == num_syms);
+      REQUIRE(counts.GetTotal() == num_syms);
+      REQUIRE(node.GetMean() == expected.GetMean());
+      REQUIRE(node.GetHistCounts() == expected.GetHistCounts());
+    }
+
+    WHEN("the population changes after the data nodes ran"){
+      world.Update();
+      for (size_t i = 0; i < world.GetSize(); i++) {
+        if (!world.IsOccupied(i)) continue;
+        for (emp::Ptr<Organism> sym : world.GetOrg(i).GetSymbionts()) sym.Delete();
+        world.GetOrg(i).ClearSyms();
+      }
+      THEN("the table is rebuilt for the new update when it is next asked for"){
+        HostedSymTable & table = world.UseHostedSymTable();
+        REQUIRE(table.IsBuiltAt(world.GetUpdate()));
+        REQUIRE(table.GetNumSyms() == 0);
+      }
+    }
+  }
+}
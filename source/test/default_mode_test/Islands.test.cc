@@ -0,0 +1,129 @@
+#include "../../default_mode/SymWorld.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+#include "../../default_mode/Islands.h"
+
+TEST_CASE("ForEachIsland", "[default]"){
+  emp::vector<size_t> visits(100, 0);
+  ForEachIsland(100, [&](size_t i){ visits[i]++; });
+  size_t num_wrong = 0;
+  for (size_t count : visits) if (count != 1) num_wrong++;
+  REQUIRE(num_wrong == 0);
+
+  REQUIRE_THROWS(ForEachIsland(10, [](size_t i){ if (i == 7) throw "island failed"; }));
+  REQUIRE_THROWS_AS(ForEachIsland(10, [](size_t i){ if (i == 3) throw std::bad_alloc(); }), std::bad_alloc);
+  REQUIRE_THROWS_AS(ForEachIsland(10, [](size_t i){ if (i == 5) throw std::runtime_error("island failed"); }), std::runtime_error);
+}
+
+TEST_CASE("Emigrate and Immigrate", "[default]"){
+  GIVEN("a host with symbionts and a free-living symbiont on one of two islands"){
+    SymConfigBase config;
+    config.SYM_LIMIT(3);
+    config.FREE_LIVING_SYMS(1);
+    emp::Random random(11);
+    SymWorld world(random, &config);
+    world.Resize(10, 10);
+    emp::Random other_random(12);
+    SymWorld other(other_random, &config);
+    other.Resize(10, 10);
+
+    emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0.25);
+    host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, -0.5));
+    host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0.75));
+    world.AddOrgAt(host, emp::WorldPosition(3));
+    world.AddOrgAt(emp::NewPtr<Symbiont>(&random, &world, &config, 0.5), emp::WorldPosition(0, 4));
+
+    WHEN("everything leaves"){
+      emp::vector<std::string> outboxes(2);
+      REQUIRE(world.Emigrate(0, 2, 1.0, outboxes) == 2);
+
+      THEN("the organisms are written to the other island's outbox and leave the world"){
+        REQUIRE(world.GetNumOrgs() == 0);
+        REQUIRE(outboxes[0].empty());
+        REQUIRE(!outboxes[1].empty());
+      }
+
+      THEN("the other island takes them in as they were"){
+        REQUIRE(other.Immigrate(outboxes[1]) == 2);
+        REQUIRE(other.GetNumOrgs() == 2);
+        emp::Ptr<Organism> arrived_host;
+        emp::Ptr<Organism> arrived_sym;
+        for (size_t i = 0; i < other.GetSize(); i++) {
+          if (other.IsOccupied(i)) arrived_host = other.GetOrgPtr(i);
+          if (other.GetSymPop()[i]) arrived_sym = other.GetSymPop()[i];
+        }
+        REQUIRE(arrived_host->GetIntVal() == 0.25);
+        REQUIRE(arrived_host->GetSymbionts().size() == 2);
+        REQUIRE(arrived_host->GetSymbionts()[1]->GetIntVal() == 0.75);
+        REQUIRE(arrived_host->GetSymbionts()[1]->GetHost() == arrived_host);
+        REQUIRE(arrived_sym->GetIntVal() == 0.5);
+      }
+    }
+
+    WHEN("nothing leaves"){
+      emp::vector<std::string> outboxes(2);
+      THEN("the world is unchanged"){
+        REQUIRE(world.Emigrate(0, 2, 0.0, outboxes) == 0);
+        REQUIRE(world.GetNumOrgs() == 2);
+        REQUIRE(other.Immigrate(outboxes[1]) == 0);
+      }
+    }
+  }
+}
+
+TEST_CASE("MigrateBetweenIslands", "[default]"){
+  GIVEN("several full islands"){
+    SymConfigBase config;
+    config.FREE_LIVING_SYMS(1);
+
+    auto build = [&config](emp::vector<emp::Ptr<emp::Random>> & randoms){
+      emp::vector<emp::Ptr<SymWorld>> islands;
+      for (size_t i = 0; i < 6; i++) {
+        randoms.push_back(emp::NewPtr<emp::Random>(20 + i));
+        emp::Ptr<SymWorld> island = emp::NewPtr<SymWorld>(*randoms[i], &config);
+        island->Resize(20, 20);
+        for (size_t cell = 0; cell < island->GetSize(); cell++) {
+          island->AddOrgAt(emp::NewPtr<Host>(randoms[i], island, &config, i / 10.0), emp::WorldPosition(cell));
+          island->AddOrgAt(emp::NewPtr<Symbiont>(randoms[i], island, &config, -(i / 10.0)), emp::WorldPosition(0, cell));
+        }
+        islands.push_back(island);
+      }
+      return islands;
+    };
+    auto clean_up = [](emp::vector<emp::Ptr<SymWorld>> & islands, emp::vector<emp::Ptr<emp::Random>> & randoms){
+      for (emp::Ptr<SymWorld> island : islands) island.Delete();
+      for (emp::Ptr<emp::Random> random : randoms) random.Delete();
+    };
+
+    emp::vector<emp::Ptr<emp::Random>> randoms;
+    emp::vector<emp::Ptr<SymWorld>> islands = build(randoms);
+    size_t num_moved = MigrateBetweenIslands(islands, 0.1);
+
+    THEN("migrants settle on other islands"){
+      REQUIRE(num_moved > 0);
+      size_t num_foreign = 0;
+      for (size_t i = 0; i < islands.size(); i++) {
+        for (size_t cell = 0; cell < islands[i]->GetSize(); cell++) {
+          if (islands[i]->IsOccupied(cell) && islands[i]->GetOrg(cell).GetIntVal() != i / 10.0) num_foreign++;
+        }
+      }
+      REQUIRE(num_foreign > 0);
+    }
+
+    THEN("the same seeds migrate the same organisms"){
+      emp::vector<emp::Ptr<emp::Random>> other_randoms;
+      emp::vector<emp::Ptr<SymWorld>> others = build(other_randoms);
+      REQUIRE(MigrateBetweenIslands(others, 0.1) == num_moved);
+      size_t num_different = 0;
+      for (size_t i = 0; i < islands.size(); i++) {
+        for (size_t cell = 0; cell < islands[i]->GetSize(); cell++) {
+          if (islands[i]->IsOccupied(cell) != others[i]->IsOccupied(cell)) num_different++;
+          else if (islands[i]->IsOccupied(cell) && islands[i]->GetOrg(cell).GetIntVal() != others[i]->GetOrg(cell).GetIntVal()) num_different++;
+        }
+      }
+      REQUIRE(num_different == 0);
+      clean_up(others, other_randoms);
+    }
+    clean_up(islands, randoms);
+  }
+}
@@ -0,0 +1,70 @@
+#include "../../default_mode/MeanFieldWorld.h"
+
+TEST_CASE("MeanFieldWorld", "[default]"){
+  SymConfigBase config;
+  config.GRID_X(30);
+  config.GRID_Y(30);
+  config.HOST_INT(0.33);
+  config.SYM_INT(-0.2);
+  config.START_MOI(1);
+
+  WHEN("the configuration uses something the solver does not model"){
+    config.FREE_LIVING_SYMS(1);
+    THEN("it is turned down"){
+      REQUIRE_THROWS(MeanFieldWorld(&config));
+    }
+  }
+
+  WHEN("a world is set up"){
+    MeanFieldWorld world(&config);
+    world.Setup();
+    THEN("it holds the expected starting population, with exact means"){
+      REQUIRE(world.GetNumHosts() == Approx(900));
+      REQUIRE(world.GetNumUninfectedHosts() == Approx(900 * std::exp(-1.0)));
+      REQUIRE(world.GetNumSyms() == Approx(900 * (1 - std::exp(-1.0))));
+      REQUIRE(world.GetMeanHostIntVal() == Approx(0.33));
+      REQUIRE(world.GetMeanSymIntVal() == Approx(-0.2));
+    }
+
+    THEN("it runs the same every time and keeps the world full"){
+      MeanFieldWorld other(&config);
+      other.Setup();
+      size_t num_different = 0;
+      for (size_t i = 0; i < 300; i++) {
+        world.Update();
+        other.Update();
+        if (world.GetMeanHostIntVal() != other.GetMeanHostIntVal() || world.GetNumSyms() != other.GetNumSyms()) num_different++;
+      }
+      REQUIRE(num_different == 0);
+      REQUIRE(world.GetNumHosts() == Approx(900));
+      double hist_total = 0;
+      for (size_t bin = 0; bin < 21; bin++) hist_total += world.GetHostHistCount(bin);
+      REQUIRE(hist_total == Approx(world.GetNumHosts()));
+    }
+  }
+
+  WHEN("symbionts are only transmitted vertically"){
+    config.VERTICAL_TRANSMISSION(1);
+    config.HORIZ_TRANS(0);
+    config.HOST_INT(-2);
+    config.SYM_INT(-2);
+    MeanFieldWorld world(&config);
+    world.Setup();
+    for (size_t i = 0; i < 500; i++) world.Update();
+    THEN("they evolve to be mutualists"){
+      REQUIRE(world.GetMeanSymIntVal() > 0.3);
+    }
+  }
+
+  WHEN("symbionts are only transmitted horizontally"){
+    config.VERTICAL_TRANSMISSION(0);
+    config.HOST_INT(-2);
+    config.SYM_INT(-2);
+    MeanFieldWorld world(&config);
+    world.Setup();
+    for (size_t i = 0; i < 500; i++) world.Update();
+    THEN("they evolve to be parasites"){
+      REQUIRE(world.GetMeanSymIntVal() < -0.3);
+    }
+  }
+}
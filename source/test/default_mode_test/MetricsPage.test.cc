@@ -0,0 +1,62 @@
+#include "../../default_mode/MetricsPage.h"
+#include "../../default_mode/SymWorld.h"
+#include "../../default_mode/DataNodes.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+
+TEST_CASE("MetricsPage", "[default]"){
+  GIVEN("a world publishing to a metrics page"){
+    emp::Random random(17);
+    SymConfigBase config;
+    config.SYM_LIMIT(2);
+    SymWorld world(random, &config);
+    world.Resize(4);
+    std::string name = "/symbulation_test_" + std::to_string(getpid());
+    REQUIRE(world.SetupMetricsPage(name));
+
+    for(size_t i = 0; i < 3; i++){
+      emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0.5);
+      host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, -0.5));
+      world.AddOrgAt(host, i);
+    }
+
+    MetricsPage reader(name, false);
+    REQUIRE(reader.IsOpen());
+
+    WHEN("the world updates"){
+      world.Update();
+      MetricsSnapshot metrics;
+      REQUIRE(reader.Read(metrics));
+
+      THEN("a reader sees the current update, counts, and means"){
+        REQUIRE(metrics.update == 1);
+        REQUIRE(metrics.host_count == world.GetNumOrgs());
+        REQUIRE(metrics.free_sym_count == 0);
+        REQUIRE(metrics.sym_count == 3);
+        REQUIRE(metrics.mean_sym_intval == -0.5);
+        REQUIRE(metrics.rss_bytes == 0); //only sampled once ten seconds have passed
+      }
+    }
+
+    WHEN("another world tries to publish to a page of the same name"){
+      SymWorld other(random, &config);
+
+      THEN("it cannot create the page, and the first world keeps it"){
+        REQUIRE(other.SetupMetricsPage(name) == false);
+        world.Update();
+        MetricsSnapshot metrics;
+        REQUIRE(reader.Read(metrics));
+        REQUIRE(metrics.update == 1);
+      }
+    }
+  }
+
+  GIVEN("no page of that name"){
+    MetricsPage reader("/symbulation_test_missing", false);
+    THEN("the reader does not open"){
+      REQUIRE(reader.IsOpen() == false);
+      MetricsSnapshot metrics;
+      REQUIRE(reader.Read(metrics) == false);
+    }
+  }
+}
@@ -0,0 +1,80 @@
+#include "../../default_mode/SymWorld.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+#include "../../default_mode/PopulationFile.h"
+#include <cstdio>
+#include <fstream>
+
+TEST_CASE("SeedPopulationFromFile", "[default]"){
+  GIVEN("a world whose settings name a population file"){
+    emp::Random random(17);
+    SymConfigBase config;
+    config.GRID_X(5);
+    config.GRID_Y(2);
+    config.SYM_LIMIT(2);
+    config.FREE_LIVING_SYMS(1);
+    config.POP_FILE("PopulationFileTest.csv");
+    SymWorld world(random, &config);
+    auto make_host = [&](double int_val){ return emp::NewPtr<Host>(&random, &world, &config, int_val); };
+    auto make_sym = [&](double int_val){ return emp::NewPtr<Symbiont>(&random, &world, &config, int_val); };
+
+    WHEN("the file is a CSV of cells"){
+      std::ofstream("PopulationFileTest.csv") << "cell,host_int_val,sym_int_vals\n"
+                                              << "0,0.5,-0.25 0.75\n"
+                                              << "3,-1,\n"
+                                              << "7,,0.125\n";
+      REQUIRE(SeedPopulationFromFile(&world, &config, make_host, make_sym));
+
+      THEN("the world is sized from the settings and holds the listed organisms"){
+        REQUIRE(world.GetSize() == 10);
+        REQUIRE(world.GetNumOrgs() == 3);
+        REQUIRE(world.GetOrg(0).GetIntVal() == 0.5);
+        REQUIRE(world.GetOrg(0).GetSymbionts().size() == 2);
+        REQUIRE(world.GetOrg(0).GetSymbionts()[1]->GetIntVal() == 0.75);
+        REQUIRE(world.GetOrg(3).GetIntVal() == -1);
+        REQUIRE(world.GetOrg(3).GetSymbionts().size() == 0);
+        REQUIRE(!world.IsOccupied(7));
+        REQUIRE(world.GetSymPop()[7]->GetIntVal() == 0.125);
+      }
+      std::remove("PopulationFileTest.csv");
+    }
+
+    WHEN("the file names a cell outside the world"){
+      std::ofstream("PopulationFileTest.csv") << "10,0.5,\n";
+      THEN("an exception is thrown"){
+        REQUIRE_THROWS(SeedPopulationFromFile(&world, &config, make_host, make_sym));
+      }
+      std::remove("PopulationFileTest.csv");
+    }
+
+    WHEN("the file is a checkpoint of another run"){
+      SymWorld evolved(random, &config);
+      evolved.Resize(10);
+      emp::Ptr<Organism> host = emp::NewPtr<Host>(&random, &evolved, &config, 0.3);
+      host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &evolved, &config, -0.3));
+      evolved.AddOrgAt(host, emp::WorldPosition(4));
+      for (int i = 0; i < 3; i++) evolved.Update();
+      evolved.SaveCheckpoint("PopulationFileTest.bin");
+      config.POP_FILE("PopulationFileTest.bin");
+      REQUIRE(SeedPopulationFromFile(&world, &config, make_host, make_sym));
+
+      THEN("its population is taken, but the new run starts at update 0"){
+        REQUIRE(world.GetUpdate() == 0);
+        REQUIRE(world.GetNumOrgs() == evolved.GetNumOrgs());
+        for (size_t i = 0; i < 10; i++) {
+          REQUIRE(world.IsOccupied(i) == evolved.IsOccupied(i));
+          if (world.IsOccupied(i)) REQUIRE(world.GetOrg(i).GetIntVal() == evolved.GetOrg(i).GetIntVal());
+        }
+      }
+      std::remove("PopulationFileTest.bin");
+    }
+
+    WHEN("no population file is set"){
+      config.POP_FILE("");
+      THEN("the world is left for the setup to build"){
+        REQUIRE(!SeedPopulationFromFile(&world, &config, make_host, make_sym));
+        REQUIRE(world.GetNumOrgs() == 0);
+      }
+    }
+  }
+}
@@ -0,0 +1,99 @@
+#include "../../default_mode/ReplicateAggregator.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+TEST_CASE("RunningStats", "[default]"){
+  GIVEN("running statistics of some values"){
+    RunningStats stats;
+    stats.Add(1);
+    stats.Add(2);
+    stats.Add(NAN);
+    stats.Add(6);
+
+    THEN("they match the sample mean and variance, skipping NaN"){
+      REQUIRE(stats.GetCount() == 3);
+      REQUIRE(stats.GetMean() == Approx(3));
+      REQUIRE(stats.GetVariance() == Approx(7));
+      REQUIRE(stats.GetConfidence95() == Approx(4.303 * sqrt(7.0 / 3)));
+    }
+
+    WHEN("they are merged with statistics of other values"){
+      RunningStats other;
+      other.Add(3);
+      other.Add(8);
+      stats.Merge(other);
+
+      THEN("the result is the statistics of all of the values"){
+        RunningStats all;
+        for (double value : {1, 2, 6, 3, 8}) all.Add(value);
+        REQUIRE(stats.GetCount() == 5);
+        REQUIRE(stats.GetMean() == Approx(all.GetMean()));
+        REQUIRE(stats.GetVariance() == Approx(all.GetVariance()));
+      }
+    }
+  }
+
+  GIVEN("no values or a single value"){
+    RunningStats stats;
+    THEN("the mean, variance and CI are NaN where undefined"){
+      REQUIRE(std::isnan(stats.GetMean()));
+      stats.Add(4);
+      REQUIRE(stats.GetMean() == 4);
+      REQUIRE(std::isnan(stats.GetVariance()));
+      REQUIRE(std::isnan(stats.GetConfidence95()));
+    }
+  }
+}
+
+TEST_CASE("ReplicateAggregator", "[default]"){
+  GIVEN("an aggregator for two replicates"){
+    ReplicateAggregator aggregator(2, "_SEEDS1-2");
+
+    THEN("replicate file names map to one aggregated name"){
+      REQUIRE(aggregator.GetAggregateName("Out/HostVals_data_SEED1.data") == "Out/HostVals_data_SEEDS1-2.data");
+      REQUIRE(aggregator.GetAggregateName("Out/HostVals_data_SEED2.data") == "Out/HostVals_data_SEEDS1-2.data");
+      REQUIRE(aggregator.GetAggregateName("counts.data") == "counts_SEEDS1-2.data");
+    }
+
+    WHEN("both replicates write a data file"){
+      size_t update = 0;
+      double values[2] = {0, 0};
+      emp::vector<emp::Ptr<ReplicateDataFile>> files;
+      for (size_t rep = 0; rep < 2; rep++) {
+        std::string name = "ReplicateAggregatorTest_SEED" + std::to_string(rep + 1) + ".data";
+        files.push_back(emp::NewPtr<ReplicateDataFile>(CapturingDataFile::GetNullStream(), name, aggregator));
+        files[rep]->AddVar(update, "update");
+        files[rep]->AddVar(values[rep], "value");
+        files[rep]->PrintHeaderKeys();
+      }
+      values[0] = 1; values[1] = 3;
+      files[0]->Update();
+      files[1]->Update();
+      update = 10;
+      values[0] = 2; values[1] = 2;
+      files[0]->Update();
+
+      std::ifstream in("ReplicateAggregatorTest_SEEDS1-2.data");
+      std::stringstream contents;
+      contents << in.rdbuf();
+
+      THEN("a row is aggregated once every replicate has reported it"){
+        REQUIRE(contents.str() == "update,value_mean,value_var,value_ci95\n0,2,2,12.706\n");
+      }
+
+      THEN("no per-seed files are written"){
+        REQUIRE(!std::ifstream("ReplicateAggregatorTest_SEED1.data").good());
+      }
+
+      for (emp::Ptr<ReplicateDataFile> file : files) file.Delete();
+      std::remove("ReplicateAggregatorTest_SEEDS1-2.data");
+    }
+
+    WHEN("a row is reported before its header"){
+      THEN("an exception is thrown"){
+        REQUIRE_THROWS(aggregator.AddRow("unknown.data", "0,1"));
+      }
+    }
+  }
+}
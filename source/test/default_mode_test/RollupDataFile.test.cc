@@ -0,0 +1,94 @@
+#include "../../default_mode/RollupDataFile.h"
+#include "../../default_mode/SymWorld.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+TEST_CASE("ParseRollupSpans", "[default]"){
+  GIVEN("a list of spans"){
+    THEN("each span is read"){
+      REQUIRE(ParseRollupSpans("10,100, 1000") == emp::vector<size_t>({10, 100, 1000}));
+      REQUIRE(ParseRollupSpans("").size() == 0);
+    }
+    THEN("spans that are not multiples of the one before are rejected"){
+      REQUIRE_THROWS(ParseRollupSpans("10,25"));
+      REQUIRE_THROWS(ParseRollupSpans("0"));
+    }
+  }
+}
+
+TEST_CASE("RollupDataFile", "[default]"){
+  GIVEN("a rollup file over spans of 2 and 4 updates keeping the 3 most recent rows"){
+    size_t update = 0;
+    double value = 0;
+    emp::Ptr<RollupDataFile> file = emp::NewPtr<RollupDataFile>("RollupDataFileTest.data", emp::vector<size_t>({2, 4}), 3);
+    file->AddVar(update, "update");
+    file->AddVar(value, "value");
+    file->PrintHeaderKeys();
+
+    auto read = [](const std::string & name){
+      std::ifstream in(name);
+      std::stringstream contents;
+      contents << in.rdbuf();
+      return contents.str();
+    };
+
+    WHEN("rows are written for updates 0 to 4 and the file is closed"){
+      for (update = 0; update < 5; update++) {
+        value = update * 2;
+        file->Update();
+      }
+      file.Delete();
+
+      THEN("the file itself only holds the most recent rows"){
+        REQUIRE(read("RollupDataFileTest.data") == "update,value\n2,4\n3,6\n4,8\n");
+      }
+
+      THEN("each span's windows are summarized in their own file, including the last partial window"){
+        REQUIRE(read("RollupDataFileTest_rollup2.data") ==
+                "update,rows,value_mean,value_min,value_max\n0,2,1,0,2\n2,2,5,4,6\n4,1,8,8,8\n");
+        REQUIRE(read("RollupDataFileTest_rollup4.data") ==
+                "update,rows,value_mean,value_min,value_max\n0,4,3,0,6\n4,1,8,8,8\n");
+      }
+
+      std::remove("RollupDataFileTest.data");
+      std::remove("RollupDataFileTest_rollup2.data");
+      std::remove("RollupDataFileTest_rollup4.data");
+    }
+
+    WHEN("rows are written past the first window of the shortest span"){
+      for (update = 0; update < 3; update++) {
+        value = update * 2;
+        file->Update();
+      }
+
+      THEN("the recent rows and the completed window are on disk before the file is closed"){
+        REQUIRE(read("RollupDataFileTest.data") == "update,value\n0,0\n1,2\n2,4\n");
+        REQUIRE(read("RollupDataFileTest_rollup2.data") ==
+                "update,rows,value_mean,value_min,value_max\n0,2,1,0,2\n");
+      }
+
+      file.Delete();
+      std::remove("RollupDataFileTest.data");
+      std::remove("RollupDataFileTest_rollup2.data");
+      std::remove("RollupDataFileTest_rollup4.data");
+    }
+  }
+}
+
+TEST_CASE("Rollups with other output settings", "[default]"){
+  GIVEN("a world set to roll its data files up"){
+    emp::Random random(5);
+    SymConfigBase config;
+    config.ROLLUP_LEVELS("10,100");
+    SymWorld world(random, &config);
+
+    THEN("it can be set up on its own"){
+      REQUIRE_NOTHROW(world.CheckOutputSettings());
+    }
+    THEN("it cannot also be checkpointed, since rollups are not saved in checkpoints"){
+      config.CHECKPOINT_INT(100);
+      REQUIRE_THROWS(world.CheckOutputSettings());
+    }
+  }
+}
@@ -0,0 +1,152 @@
+#include "../../default_mode/RowStream.h"
+#include "../../default_mode/SymWorld.h"
+#include "../../default_mode/DataNodes.h"
+#include "../../default_mode/Host.h"
+#include <fstream>
+
+TEST_CASE("FrameQueue", "[default]"){
+  GIVEN("a frame queue with room for two frames"){
+    FrameQueue<std::string, 2> queue;
+    std::string frame;
+    REQUIRE(queue.Pop(frame) == false);
+
+    WHEN("more frames are pushed than fit"){
+      REQUIRE(queue.Push("a"));
+      REQUIRE(queue.Push("b"));
+      REQUIRE(queue.Push("c") == false);
+
+      THEN("the extra frame is dropped and the rest pop in order"){
+        REQUIRE(queue.Pop(frame));
+        REQUIRE(frame == "a");
+        REQUIRE(queue.Push("d"));
+        REQUIRE(queue.Pop(frame));
+        REQUIRE(frame == "b");
+        REQUIRE(queue.Pop(frame));
+        REQUIRE(frame == "d");
+        REQUIRE(queue.Pop(frame) == false);
+      }
+    }
+  }
+}
+
+TEST_CASE("RowStream", "[default]"){
+  GIVEN("a world streaming its data files to a socket"){
+    emp::Random random(17);
+    SymConfigBase config;
+    config.DATA_SOCKET_RASTER(1);
+    config.DATA_INT(1);
+    SymWorld world(random, &config);
+    world.Resize(2);
+    world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.5), 0);
+
+    std::string path = "/tmp/symbulation_test_" + std::to_string(getpid()) + ".sock";
+    REQUIRE(world.SetupRowStream(path));
+    RowSubscriber subscriber(path);
+    REQUIRE(subscriber.IsOpen());
+
+    std::string filename = "/tmp/symbulation_test_" + std::to_string(getpid()) + ".data";
+    world.SetupHostIntValFile(filename);
+
+    WHEN("the world updates"){
+      world.Update();
+
+      THEN("the subscriber receives the header, the row, and a raster"){
+        std::string source, row;
+        REQUIRE(subscriber.Receive(source, row, 1000));
+        REQUIRE(source == filename);
+        REQUIRE(row.find("update,mean_intval,count") == 0);
+
+        REQUIRE(subscriber.Receive(source, row, 1000));
+        REQUIRE(source == filename);
+        REQUIRE(row.find("0,0.5,1,1,") == 0);
+
+        REQUIRE(subscriber.Receive(source, row, 1000));
+        REQUIRE(source == "raster_host_intval");
+        REQUIRE(row == "1,0.5,");
+        REQUIRE(world.GetRowStream()->GetDropped() == 0);
+      }
+    }
+    std::remove(filename.c_str());
+  }
+}
+
+TEST_CASE("RowStream subscribers and rasters", "[default]"){
+  GIVEN("a stream with a header already set"){
+    std::string path = "/tmp/symbulation_test_late_" + std::to_string(getpid()) + ".sock";
+    RowStream stream(path);
+    REQUIRE(stream.IsOpen());
+    stream.SetHeader("file", "update,count");
+
+    WHEN("a subscriber connects afterwards"){
+      RowSubscriber subscriber(path);
+      REQUIRE(subscriber.IsOpen());
+      std::string source, payload;
+      REQUIRE(subscriber.Receive(source, payload, 1000));
+
+      THEN("it is sent the header, and rasters pushed faster than they are sent keep the latest"){
+        REQUIRE(source == "file");
+        REQUIRE(payload == "update,count");
+        for (size_t i = 1; i <= 50; i++) stream.PushRaster("raster", std::to_string(i));
+        size_t received = 0;
+        while (subscriber.Receive(source, payload, 200)) {
+          REQUIRE(source == "raster");
+          received++;
+        }
+        REQUIRE(received >= 1);
+        REQUIRE(received <= 50);
+        REQUIRE(payload == "50");
+        REQUIRE(stream.GetDropped() == 0);
+      }
+    }
+  }
+}
+
+TEST_CASE("RowStream with checkpoints", "[default]"){
+  GIVEN("a checkpointing world streaming its data files to a socket"){
+    emp::Random random(18);
+    SymConfigBase config;
+    config.DATA_INT(1);
+    config.CHECKPOINT_INT(1000);
+    std::string path = "/tmp/symbulation_test_ckpt_" + std::to_string(getpid()) + ".sock";
+    std::string filename = "/tmp/symbulation_test_ckpt_" + std::to_string(getpid()) + ".data";
+    std::string checkpoint = "/tmp/symbulation_test_ckpt_" + std::to_string(getpid()) + ".bin";
+    std::string saved_rows;
+    {
+      SymWorld world(random, &config);
+      world.Resize(2);
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.5), 0);
+      REQUIRE(world.SetupRowStream(path));
+      RowSubscriber subscriber(path);
+      REQUIRE(subscriber.IsOpen());
+      world.SetupHostIntValFile(filename);
+      world.Update();
+      world.SaveCheckpoint(checkpoint);
+      std::ifstream saved(filename);
+      saved_rows.assign(std::istreambuf_iterator<char>(saved), std::istreambuf_iterator<char>());
+      world.Update();
+
+      std::string source, row;
+      REQUIRE(subscriber.Receive(source, row, 1000));
+      REQUIRE(row.find("update,mean_intval,count") == 0);
+      REQUIRE(subscriber.Receive(source, row, 1000));
+      REQUIRE(row.find("0,0.5,1,1,") == 0);
+    }
+
+    WHEN("the run is resumed from its checkpoint"){
+      emp::Random other_random(19);
+      SymWorld resumed(other_random, &config);
+      resumed.Resize(2);
+      resumed.LoadCheckpoint(checkpoint);
+      REQUIRE(resumed.SetupRowStream(path));
+      resumed.SetupHostIntValFile(filename);
+
+      THEN("its data file continues from the rows written before the checkpoint"){
+        std::ifstream in(filename);
+        std::string rows((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        REQUIRE(rows == saved_rows);
+      }
+    }
+    std::remove(filename.c_str());
+    std::remove(checkpoint.c_str());
+  }
+}
@@ -0,0 +1,104 @@
+#include "../../default_mode/SymWorld.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+#include "../../default_mode/StopConditions.h"
+
+TEST_CASE("PopulationTally", "[default]"){
+  PopulationTally tally;
+  REQUIRE(tally.GetHostVariance() == 0);
+  tally.AddHost(0.5);
+  tally.AddHost(-0.5);
+  tally.AddSym(0.25);
+  tally.AddSym(0.25);
+  tally.AddSym(0.25);
+  REQUIRE(tally.host_count == 2);
+  REQUIRE(tally.sym_count == 3);
+  REQUIRE(tally.GetHostVariance() == Approx(0.25));
+  REQUIRE(tally.GetSymVariance() == Approx(0));
+}
+
+TEST_CASE("StopConditions", "[default]"){
+  SymConfigBase config;
+  PopulationTally no_syms;
+  no_syms.AddHost(0.5);
+  no_syms.AddHost(-0.5);
+
+  WHEN("no stop condition is set"){
+    StopConditions conditions(config);
+    THEN("nothing stops the run"){
+      REQUIRE(!conditions.Any());
+      REQUIRE(conditions.Check(100, PopulationTally()) == StopReason::NONE);
+    }
+  }
+
+  WHEN("symbiont extinction stops the run"){
+    config.STOP_SYM_EXTINCTION(1);
+    config.STOP_CHECK_START(10);
+    StopConditions conditions(config);
+    THEN("it stops once the symbionts are gone, but not before STOP_CHECK_START"){
+      REQUIRE(conditions.UsesTally());
+      REQUIRE(conditions.Check(5, no_syms) == StopReason::NONE);
+      REQUIRE(conditions.Check(10, no_syms) == StopReason::SYM_EXTINCTION);
+    }
+  }
+
+  WHEN("low variance stops the run"){
+    config.STOP_INTVAL_VARIANCE(0.1);
+    StopConditions conditions(config);
+    THEN("it stops only once both partners vary less than that"){
+      REQUIRE(conditions.Check(0, no_syms) == StopReason::NONE);
+      PopulationTally uniform;
+      uniform.AddHost(0.5);
+      uniform.AddSym(0.2);
+      REQUIRE(conditions.Check(0, uniform) == StopReason::LOW_VARIANCE);
+    }
+  }
+
+  WHEN("there is a wall-clock budget"){
+    config.STOP_WALL_SECONDS(1e-9);
+    StopConditions conditions(config);
+    THEN("it stops once the budget is spent, without needing a tally"){
+      REQUIRE(!conditions.UsesTally());
+      REQUIRE(conditions.Any());
+      REQUIRE(conditions.Check(0, no_syms) == StopReason::WALL_CLOCK);
+    }
+  }
+}
+
+TEST_CASE("SymWorld stops early", "[default]"){
+  GIVEN("a world whose symbionts cannot be passed on"){
+    SymConfigBase config;
+    config.VERTICAL_TRANSMISSION(0);
+    config.HORIZ_TRANS(0);
+    config.UPDATES(1000);
+    config.NO_MUT_UPDATES(100);
+    emp::Random random(8);
+    SymWorld world(random, &config);
+    world.Resize(20, 20);
+    for (size_t i = 0; i < world.GetSize(); i++) {
+      emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0.1);
+      host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0.1));
+      world.AddOrgAt(host, i);
+    }
+
+    WHEN("the run stops when the symbionts go extinct"){
+      config.STOP_SYM_EXTINCTION(1);
+      world.RunExperiment(false);
+      THEN("it ends soon after they are gone"){
+        REQUIRE(world.GetUpdate() < 1000);
+        size_t num_syms = 0;
+        for (size_t i = 0; i < world.GetSize(); i++) {
+          if (world.IsOccupied(i)) num_syms += world.GetOrgPtr(i)->GetSymbionts().size();
+        }
+        REQUIRE(num_syms == 0);
+      }
+    }
+
+    WHEN("no stop condition is set"){
+      world.RunExperiment(false);
+      THEN("it runs every update"){
+        REQUIRE(world.GetUpdate() == 1100);
+      }
+    }
+  }
+}
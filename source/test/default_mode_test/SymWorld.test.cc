@@ -1432,3 +1432,110 @@ TEST_CASE( "IsInboundsPos", "[default]" ){
     REQUIRE(world.IsInboundsPos(invalid_pos) == false);
   }
 }
+
+TEST_CASE( "DetectEventListeners", "[default]" ){
+  GIVEN( "two worlds of hosts with symbionts built from the same seed" ){
+    SymConfigBase config;
+    config.SYM_LIMIT(3);
+    config.HORIZ_TRANS(1);
+    config.MUTATION_SIZE(0.1);
+    size_t width = 10;
+    size_t num_updates = 20;
+    emp::Random general_random(7);
+    emp::Random quiet_random(7);
+    SymWorld general(general_random, &config);
+    SymWorld quiet(quiet_random, &config);
+    for (SymWorld * world : {&general, &quiet}) {
+      world->SetPopStruct_Grid(width, width, false);
+      emp::Random & random = world->GetRandom();
+      for (size_t i = 0; i < width * width; i += 2) {
+        emp::Ptr<Organism> host = emp::NewPtr<Host>(&random, world, &config, random.GetDouble(-1, 1));
+        host->AddSymbiont(emp::NewPtr<Symbiont>(&random, world, &config, random.GetDouble(-1, 1)));
+        world->AddOrgAt(host, emp::WorldPosition(i));
+      }
+    }
+    REQUIRE(general.HasQuietBirths() == false);
+
+    WHEN( "only one of them skips the signals, which nothing listens to" ){
+      quiet.DetectEventListeners();
+      REQUIRE(quiet.HasQuietBirths() == true);
+      for (size_t i = 0; i < num_updates; i++) {
+        general.Update();
+        quiet.Update();
+      }
+
+      THEN( "both have the same population" ){
+        REQUIRE(quiet.GetNumOrgs() == general.GetNumOrgs());
+        size_t different_cells = 0;
+        for (size_t i = 0; i < width * width; i++) {
+          if (quiet.IsOccupied(i) != general.IsOccupied(i)) different_cells++;
+          else if (general.IsOccupied(i) && (quiet.GetOrg(i).GetIntVal() != general.GetOrg(i).GetIntVal()
+              || quiet.GetOrg(i).GetSymbionts().size() != general.GetOrg(i).GetSymbionts().size())) different_cells++;
+        }
+        REQUIRE(different_cells == 0);
+      }
+    }
+
+    WHEN( "something listens to deaths" ){
+      size_t deaths = 0;
+      quiet.OnOrgDeath([&deaths](size_t pos){ deaths++; });
+      quiet.DetectEventListeners();
+
+      THEN( "the signals are still sent" ){
+        REQUIRE(quiet.HasQuietBirths() == false);
+        quiet.DoDeath(emp::WorldPosition(0));
+        REQUIRE(deaths == 1);
+      }
+    }
+  }
+
+  GIVEN( "a world that keeps a phylogeny" ){
+    emp::Random random(7);
+    SymConfigBase config;
+    config.PHYLOGENY(1);
+    SymWorld world(random, &config);
+    world.DetectEventListeners();
+
+    THEN( "births and deaths go through the systematics hooks" ){
+      REQUIRE(world.HasQuietBirths() == false);
+    }
+  }
+}
+
+TEST_CASE( "Graveyard", "[default]" ){
+  GIVEN( "a world with a free-living symbiont and a host" ){
+    emp::Random random(17);
+    SymConfigBase config;
+    config.FREE_LIVING_SYMS(1);
+    SymWorld world(random, &config);
+    world.Resize(2);
+    world.DetectEventListeners();
+    emp::Ptr<Organism> host = emp::NewPtr<Host>(&random, &world, &config, 0);
+    world.AddOrgAt(host, 0);
+    world.AddOrgAt(emp::NewPtr<Symbiont>(&random, &world, &config, 0), emp::WorldPosition(0, 1));
+    REQUIRE(world.GetGraveyardSize() == 0);
+
+    WHEN( "they die" ){
+      world.DoSymDeath(1);
+      world.DoDeath(emp::WorldPosition(0));
+
+      THEN( "they leave the world at once and are destroyed at the end of the update" ){
+        REQUIRE(world.GetNumOrgs() == 0);
+        REQUIRE(world.IsOccupied(0) == false);
+        REQUIRE(world.GetSymPop()[1] == nullptr);
+        REQUIRE(world.GetGraveyardSize() == 2);
+        world.Update();
+        REQUIRE(world.GetGraveyardSize() == 0);
+      }
+    }
+
+    WHEN( "a new symbiont takes the free-living symbiont's place" ){
+      world.AddOrgAt(emp::NewPtr<Symbiont>(&random, &world, &config, 0), emp::WorldPosition(0, 1));
+
+      THEN( "the old one is buried" ){
+        REQUIRE(world.GetNumOrgs() == 2);
+        REQUIRE(world.GetGraveyardSize() == 1);
+      }
+    }
+  }
+}
@@ -0,0 +1,141 @@
+#include "../../default_mode/TauLeapWorld.h"
+
+TEST_CASE("DrawBinomial", "[default]"){
+  emp::Random random(3);
+  REQUIRE(DrawBinomial(random, 0, 0.5) == 0);
+  REQUIRE(DrawBinomial(random, 10, 0) == 0);
+  REQUIRE(DrawBinomial(random, 10, 1) == 10);
+
+  // means for the exact (few successes) and normal (many successes) draws
+  for (double p : {0.001, 0.3, 0.9}) {
+    size_t n = 10000;
+    double total = 0;
+    size_t num_draws = 1000;
+    size_t num_out_of_range = 0;
+    for (size_t i = 0; i < num_draws; i++) {
+      size_t draw = DrawBinomial(random, n, p);
+      if (draw > n) num_out_of_range++;
+      total += draw;
+    }
+    REQUIRE(num_out_of_range == 0);
+    REQUIRE(std::abs(total / num_draws - n * p) < 0.02 * n * p + 0.5);
+  }
+}
+
+TEST_CASE("DrawWithoutReplacement", "[default]"){
+  emp::Random random(4);
+  emp::vector<size_t> counts = {5, 0, 100, 3, 40};
+  emp::vector<size_t> taken = DrawWithoutReplacement(random, counts, 120);
+  size_t total_taken = 0;
+  size_t total_left = 0;
+  for (size_t i = 0; i < counts.size(); i++) {
+    total_taken += taken[i];
+    total_left += counts[i];
+  }
+  REQUIRE(total_taken == 120);
+  REQUIRE(total_left == 28);
+  REQUIRE(taken[1] == 0);
+
+  taken = DrawWithoutReplacement(random, counts, 1000);
+  total_left = 0;
+  for (size_t count : counts) total_left += count;
+  REQUIRE(total_left == 0);
+}
+
+TEST_CASE("MakeTraitKernel", "[default]"){
+  emp::vector<double> traits;
+  for (size_t i = 0; i < 201; i++) traits.push_back(-1.0 + 2.0 * i / 200);
+
+  WHEN("mutation is off"){
+    TraitKernel kernel = MakeTraitKernel(traits, 0, 0.1);
+    THEN("every bin stays put"){
+      size_t num_moving = 0;
+      for (size_t i = 0; i < traits.size(); i++) {
+        if (kernel[i].size() != 1 || kernel[i][0].first != i || kernel[i][0].second != 1.0) num_moving++;
+      }
+      REQUIRE(num_moving == 0);
+    }
+  }
+
+  WHEN("steps are smaller than a bin"){
+    double size = 0.002;
+    TraitKernel kernel = MakeTraitKernel(traits, 1, size);
+    THEN("each row sums to 1 and keeps the step's variance away from the ends"){
+      size_t num_bad_rows = 0;
+      for (size_t i = 0; i < traits.size(); i++) {
+        double total = 0;
+        double variance = 0;
+        for (const auto & move : kernel[i]) {
+          total += move.second;
+          variance += move.second * (traits[move.first] - traits[i]) * (traits[move.first] - traits[i]);
+        }
+        if (std::abs(total - 1) > 1e-9) num_bad_rows++;
+        else if (i > 0 && i + 1 < traits.size() && std::abs(variance - size * size) > 1e-9) num_bad_rows++;
+      }
+      REQUIRE(num_bad_rows == 0);
+    }
+  }
+}
+
+TEST_CASE("TauLeapWorld", "[default]"){
+  SymConfigBase config;
+  config.GRID_X(50);
+  config.GRID_Y(50);
+  config.SYM_LIMIT(3);
+  config.HOST_INT(0.5);
+  config.SYM_INT(0.25);
+  config.START_MOI(1);
+  emp::Random random(17);
+
+  WHEN("the configuration uses something the engine does not model"){
+    config.GRID(1);
+    THEN("it is turned down"){
+      REQUIRE_THROWS(TauLeapWorld(random, &config));
+    }
+  }
+
+  WHEN("a world is set up"){
+    TauLeapWorld world(random, &config);
+    world.Setup();
+    THEN("it is full of hosts with about START_MOI symbionts each"){
+      REQUIRE(world.GetNumHosts() == 2500);
+      REQUIRE(world.GetMeanHostIntVal() == Approx(0.5));
+      REQUIRE(world.GetMeanSymIntVal() == Approx(0.25));
+      REQUIRE(world.GetNumSyms() > 2000);
+      REQUIRE(world.GetNumSyms() < 2500);
+    }
+
+    THEN("the counts stay consistent as it runs"){
+      size_t num_inconsistent = 0;
+      for (size_t i = 0; i < 200; i++) {
+        world.Update();
+        size_t host_hist_total = 0;
+        size_t sym_hist_total = 0;
+        for (size_t bin = 0; bin < 21; bin++) {
+          host_hist_total += world.GetHostHistCount(bin);
+          sym_hist_total += world.GetSymHistCount(bin);
+        }
+        if (world.GetNumHosts() > 2500 || world.GetNumUninfectedHosts() > world.GetNumHosts()) num_inconsistent++;
+        if (world.GetNumSyms() > 3 * (world.GetNumHosts() - world.GetNumUninfectedHosts())) num_inconsistent++;
+        if (host_hist_total != world.GetNumHosts() || sym_hist_total != world.GetNumSyms()) num_inconsistent++;
+      }
+      REQUIRE(num_inconsistent == 0);
+      REQUIRE(world.GetUpdate() == 200);
+    }
+  }
+
+  WHEN("hosts are added by hand"){
+    TauLeapWorld world(random, &config);
+    world.AddHosts(10, 1.0, 2, -1.0);
+    world.AddHosts(30, -1.0);
+    THEN("they are counted in the right bins"){
+      REQUIRE(world.GetNumHosts() == 40);
+      REQUIRE(world.GetNumUninfectedHosts() == 30);
+      REQUIRE(world.GetNumSyms() == 20);
+      REQUIRE(world.GetMeanHostIntVal() == Approx(-0.5));
+      REQUIRE(world.GetHostHistCount(0) == 30);
+      REQUIRE(world.GetHostHistCount(20) == 10);
+      REQUIRE(world.GetSymHistCount(0) == 20);
+    }
+  }
+}
@@ -0,0 +1,54 @@
+#include "../../default_mode/Treatments.h"
+
+TEST_CASE("ParseTreatments", "[default]"){
+  GIVEN("a TREATMENTS setting with two treatments"){
+    emp::vector<Treatment> treatments = ParseTreatments("VERTICAL_TRANSMISSION=0.2; VERTICAL_TRANSMISSION=0.8, SYNERGY=3;");
+
+    THEN("each treatment's overrides are read in order"){
+      REQUIRE(treatments.size() == 2);
+      REQUIRE(treatments[0].size() == 1);
+      REQUIRE(treatments[0][0].first == "VERTICAL_TRANSMISSION");
+      REQUIRE(treatments[0][0].second == "0.2");
+      REQUIRE(treatments[1].size() == 2);
+      REQUIRE(treatments[1][1].first == "SYNERGY");
+      REQUIRE(treatments[1][1].second == "3");
+    }
+  }
+
+  GIVEN("an empty treatment between two others"){
+    emp::vector<Treatment> treatments = ParseTreatments("SYNERGY=1;;SYNERGY=5");
+    THEN("it is kept as a treatment with no overrides"){
+      REQUIRE(treatments.size() == 3);
+      REQUIRE(treatments[1].size() == 0);
+    }
+  }
+
+  GIVEN("an override without a value"){
+    THEN("an exception is thrown"){
+      REQUIRE_THROWS(ParseTreatments("SYNERGY"));
+    }
+  }
+}
+
+TEST_CASE("ApplyTreatment", "[default]"){
+  GIVEN("a configuration and a treatment"){
+    SymConfigBase config;
+    config.SYNERGY(5);
+    Treatment treatment = ParseTreatments("VERTICAL_TRANSMISSION=0.25,SYNERGY=2")[0];
+
+    WHEN("the treatment is applied"){
+      ApplyTreatment(config, treatment);
+      THEN("its settings are overridden"){
+        REQUIRE(config.VERTICAL_TRANSMISSION() == 0.25);
+        REQUIRE(config.SYNERGY() == 2);
+      }
+    }
+
+    WHEN("a treatment overrides a setting that does not exist"){
+      THEN("an exception is thrown and nothing is changed"){
+        REQUIRE_THROWS(ApplyTreatment(config, ParseTreatments("SYNERGY=1,NOT_A_SETTING=3")[0]));
+        REQUIRE(config.SYNERGY() == 5);
+      }
+    }
+  }
+}
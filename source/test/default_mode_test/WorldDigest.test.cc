@@ -0,0 +1,123 @@
+#include "../../default_mode/SymWorld.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+#include "../../default_mode/DataNodes.h"
+#include "../../default_mode/WorldDigest.h"
+#include <cstdio>
+#include <fstream>
+
+TEST_CASE("World digest", "[default]"){
+  GIVEN("two worlds of hosts with symbionts built from the same seed"){
+    SymConfigBase config;
+    config.SYM_LIMIT(3);
+    config.HORIZ_TRANS(1);
+    config.MUTATION_SIZE(0.1);
+    config.DIGEST_INT(2);
+    int world_size = 30;
+    emp::Random random_a(11);
+    emp::Random random_b(11);
+    SymWorld world_a(random_a, &config);
+    SymWorld world_b(random_b, &config);
+    for (SymWorld * world : {&world_a, &world_b}) {
+      world->Resize(world_size);
+      emp::Random & random = world->GetRandom();
+      for (int i = 0; i < world_size; i += 2) {
+        emp::Ptr<Organism> host = emp::NewPtr<Host>(&random, world, &config, random.GetDouble(-1, 1));
+        host->AddSymbiont(emp::NewPtr<Symbiont>(&random, world, &config, random.GetDouble(-1, 1)));
+        world->AddOrgAt(host, emp::WorldPosition(i));
+      }
+    }
+    world_a.SetupDigestFile("WorldDigestTestA.data");
+    world_b.SetupDigestFile("WorldDigestTestB.data");
+    REQUIRE(world_a.GetWorldDigest() == 0);
+
+    WHEN("they run the same updates"){
+      world_a.Update();
+      world_b.Update();
+      uint64_t first_digest = world_a.GetWorldDigest();
+      for (int i = 0; i < 9; i++) {
+        world_a.Update();
+        world_b.Update();
+      }
+
+      THEN("their digests agree, and change as the worlds do"){
+        REQUIRE(first_digest != 0);
+        REQUIRE(world_a.GetWorldDigest() == world_b.GetWorldDigest());
+        REQUIRE(world_a.GetWorldDigest() != first_digest);
+      }
+    }
+
+    WHEN("one host's interaction value differs after a few updates"){
+      for (int i = 0; i < 4; i++) {
+        world_a.Update();
+        world_b.Update();
+      }
+      world_b.GetOrg(0).SetIntVal(world_b.GetOrg(0).GetIntVal() / 2);
+      for (int i = 0; i < 6; i++) {
+        world_a.Update();
+        world_b.Update();
+      }
+
+      THEN("the digest files first differ at the next digest taken"){
+        world_a.SetupDigestFile("WorldDigestTestA2.data"); // closes the first file
+        world_b.SetupDigestFile("WorldDigestTestB2.data");
+        DigestComparison comparison = CompareDigestFiles("WorldDigestTestA.data", "WorldDigestTestB.data");
+        REQUIRE(comparison.first_update == 4);
+        REQUIRE(comparison.common_updates == 2);
+        REQUIRE(CompareDigestFiles("WorldDigestTestA.data", "WorldDigestTestA.data").first_update == -1);
+        std::remove("WorldDigestTestA2.data");
+        std::remove("WorldDigestTestB2.data");
+      }
+    }
+    std::remove("WorldDigestTestA.data");
+    std::remove("WorldDigestTestB.data");
+  }
+}
+
+TEST_CASE("Digest of the random number generator", "[default]"){
+  GIVEN("two generators with the same seed"){
+    emp::Random random_a(4);
+    emp::Random random_b(4);
+    auto digest = [](emp::Random & random){
+      WorldDigest digest(0, 0);
+      digest.AddRandom(random);
+      return digest.Get();
+    };
+
+    THEN("their digests agree until one of them draws a number"){
+      REQUIRE(digest(random_a) == digest(random_b));
+      random_b.GetUInt();
+      REQUIRE(digest(random_a) != digest(random_b));
+      random_a.GetUInt();
+      REQUIRE(digest(random_a) == digest(random_b));
+    }
+  }
+}
+
+TEST_CASE("CompareDigestFiles", "[default]"){
+  std::ofstream("DigestCompareTestA.data") << "update,digest\n0,00000000000000aa\n5,00000000000000bb\n10,00000000000000cc\n";
+  std::ofstream("DigestCompareTestB.data") << "update,digest\n0,00000000000000aa\n5,00000000000000bd\n10,00000000000000cd\n";
+  std::ofstream("DigestCompareTestC.data") << "update,digest\n0,00000000000000aa\n6,00000000000000bb\n";
+  std::ofstream("DigestCompareTestD.data") << "update,digest\n0,00000000000000aa\n5,00000000000000bb\n";
+
+  WHEN("two files differ"){
+    THEN("the first update they differ on is reported"){
+      DigestComparison comparison = CompareDigestFiles("DigestCompareTestA.data", "DigestCompareTestB.data");
+      REQUIRE(comparison.first_update == 5);
+      REQUIRE(comparison.common_updates == 1);
+    }
+  }
+  WHEN("one run is shorter but agrees as far as it goes"){
+    THEN("no divergence is reported"){
+      DigestComparison comparison = CompareDigestFiles("DigestCompareTestA.data", "DigestCompareTestD.data");
+      REQUIRE(comparison.first_update == -1);
+      REQUIRE(comparison.common_updates == 2);
+    }
+  }
+  WHEN("the files were written at different updates"){
+    THEN("comparing them throws"){
+      REQUIRE_THROWS(CompareDigestFiles("DigestCompareTestA.data", "DigestCompareTestC.data"));
+    }
+  }
+  for (const char * name : {"DigestCompareTestA.data", "DigestCompareTestB.data", "DigestCompareTestC.data", "DigestCompareTestD.data"}) std::remove(name);
+}
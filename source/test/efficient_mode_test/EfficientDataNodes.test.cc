@@ -41,3 +41,34 @@ TEST_CASE("GetEfficiencyDataNode", "[efficient]"){
     }
   }
 }
+
+TEST_CASE("Efficiency joint histogram", "[efficient]"){
+  GIVEN( "a world recording interaction value against efficiency" ) {
+    emp::Random random(17);
+    SymConfigBase config;
+    EfficientWorld world(random, &config);
+    world.Resize(4);
+    config.FREE_LIVING_SYMS(1);
+    config.SYM_INFECTION_CHANCE(0);
+    config.SYM_LIMIT(3);
+
+    JointHistogram & hist = world.AddJointHistogram("int_val", "efficiency", 4);
+    REQUIRE(hist.GetXBins() == 4);
+    REQUIRE(hist.GetYBins() == 4);
+
+    WHEN("efficient symbionts are added to the world"){
+      emp::Ptr<Host> host = emp::NewPtr<EfficientHost>(&random, &world, &config, 0);
+      world.AddOrgAt(host, 0);
+      world.AddOrgAt(emp::NewPtr<EfficientSymbiont>(&random, &world, &config, -0.9, 0, 0.1), emp::WorldPosition(0, 1));
+      world.AddOrgAt(emp::NewPtr<EfficientSymbiont>(&random, &world, &config, -0.9, 0, 0.2), emp::WorldPosition(0, 2));
+      host->AddSymbiont(emp::NewPtr<EfficientSymbiont>(&random, &world, &config, 0.6, 0, 1.0));
+
+      world.Update();
+      THEN("each pair of traits is counted in its joint bin"){
+        REQUIRE(hist.GetCount(0, 0) == 2);
+        REQUIRE(hist.GetCount(3, 3) == 1);
+        REQUIRE(hist.GetCount(3, 0) == 0);
+      }
+    }
+  }
+}
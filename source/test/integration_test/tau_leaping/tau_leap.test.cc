@@ -0,0 +1,95 @@
+#include "../../../default_mode/SymWorld.h"
+#include "../../../default_mode/Host.h"
+#include "../../../default_mode/Symbiont.h"
+#include "../../../default_mode/TauLeapWorld.h"
+
+TEST_CASE("Tau-leaping Matches the Individual-based Engine", "[integration]"){
+    SymConfigBase config;
+
+    //a small well-mixed world that starts full, every host with one symbiont, all with random interaction values
+    config.GRID_X(30);
+    config.GRID_Y(30);
+    config.UPDATES(1000);
+    config.NO_MUT_UPDATES(0);
+
+    //averages of the final host and symbiont interaction values and uninfected hosts over seeds
+    auto run_exact = [&config](){
+        emp::vector<double> totals(3, 0);
+        for (int seed = 1; seed <= 5; seed++) {
+            emp::Random random(seed);
+            SymWorld world(random, &config);
+            world.SetPopStruct_Mixed(false);
+            world.DetectEventListeners();
+            for (size_t i = 0; i < 900; i++) {
+                emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, random.GetDouble(-1, 1));
+                host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, random.GetDouble(-1, 1)));
+                world.AddOrgAt(host, i);
+            }
+            world.Resize(30, 30);
+            world.RunExperiment(false);
+
+            double host_total = 0, sym_total = 0;
+            size_t num_hosts = 0, num_syms = 0, num_uninfected = 0;
+            for (size_t i = 0; i < world.GetSize(); i++) {
+                if (!world.IsOccupied(i)) continue;
+                emp::Ptr<Organism> host = world.GetOrgPtr(i);
+                host_total += host->GetIntVal();
+                num_hosts++;
+                if (host->GetSymbionts().empty()) num_uninfected++;
+                for (emp::Ptr<Organism> sym : host->GetSymbionts()) {
+                    sym_total += sym->GetIntVal();
+                    num_syms++;
+                }
+            }
+            totals[0] += host_total / num_hosts / 5;
+            totals[1] += (num_syms > 0 ? sym_total / num_syms : 0) / 5;
+            totals[2] += num_uninfected / 5.0;
+        }
+        return totals;
+    };
+    auto run_tau = [&config](){
+        emp::vector<double> totals(3, 0);
+        for (int seed = 1; seed <= 5; seed++) {
+            emp::Random random(seed);
+            TauLeapWorld world(random, &config);
+            for (size_t i = 0; i < 900; i++) {
+                double host_int = random.GetDouble(-1, 1);
+                world.AddHosts(1, host_int, 1, random.GetDouble(-1, 1));
+            }
+            world.RunExperiment(false);
+            totals[0] += world.GetMeanHostIntVal() / 5;
+            totals[1] += (world.GetNumSyms() > 0 ? world.GetMeanSymIntVal() : 0) / 5;
+            totals[2] += world.GetNumUninfectedHosts() / 5.0;
+        }
+        return totals;
+    };
+
+    WHEN("Vertical transmission is high"){
+        config.VERTICAL_TRANSMISSION(0.7);
+        emp::vector<double> exact = run_exact();
+        emp::vector<double> tau = run_tau();
+
+        THEN("Both evolve mutualism to about the same degree"){
+            REQUIRE(exact[0] > 0.8);
+            REQUIRE(tau[0] > 0.8);
+            REQUIRE(std::abs(tau[0] - exact[0]) < 0.1);
+            REQUIRE(tau[1] > 0.5);
+            REQUIRE(std::abs(tau[1] - exact[1]) < 0.3);
+            REQUIRE(std::abs(tau[2] - exact[2]) < 100);
+        }
+    }
+
+    WHEN("There is no vertical transmission"){
+        config.VERTICAL_TRANSMISSION(0);
+        emp::vector<double> exact = run_exact();
+        emp::vector<double> tau = run_tau();
+
+        THEN("Both evolve parasitism to about the same degree"){
+            REQUIRE(exact[1] < -0.5);
+            REQUIRE(tau[1] < -0.5);
+            REQUIRE(std::abs(tau[0] - exact[0]) < 0.2);
+            REQUIRE(std::abs(tau[1] - exact[1]) < 0.2);
+            REQUIRE(std::abs(tau[2] - exact[2]) < 50);
+        }
+    }
+}
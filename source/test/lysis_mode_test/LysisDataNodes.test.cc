@@ -192,7 +192,7 @@ TEST_CASE("GetBurstSizeDataNode", "[lysis]"){
     config.LYSIS_CHANCE(1);
     config.BURST_TIME(burst_time);
 
-    emp::DataMonitor<double>& burst_size_data_node = world.GetBurstSizeDataNode();
+    EventCounter& burst_size_data_node = world.GetBurstSizeDataNode();
     REQUIRE(std::isnan(burst_size_data_node.GetMean()));
 
     WHEN("bacteria lyse"){
@@ -235,11 +235,11 @@ TEST_CASE("GetBurstCountDataNode", "[lysis]"){
     config.LYSIS_CHANCE(1);
     config.BURST_TIME(burst_time);
 
-    emp::DataMonitor<int>& burst_count_data_node = world.GetBurstCountDataNode();
+    EventCounter& burst_count_data_node = world.GetBurstCountDataNode();
     REQUIRE(burst_count_data_node.GetTotal() == 0);
 
     WHEN("bacteria lyse"){
-      int expected_total = 2;
+      size_t expected_total = 2;
       for(int i = 0; i < 4; i++){ // populate world with 4 bacteria
         emp::Ptr<Bacterium> bacterium = emp::NewPtr<Bacterium>(&random, &world, &config, int_val);
         emp::Ptr<Phage> phage = emp::NewPtr<Phage>(&random, &world, &config, int_val);